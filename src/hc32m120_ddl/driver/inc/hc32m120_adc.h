@@ -80,6 +80,16 @@ extern "C"
 
 #if (DDL_ADC_ENABLE == DDL_ON)
 
+/**
+ * @defgroup ADC_Channel_Count ADC Channel Count
+ * @note  Defined ahead of the types, it also sizes stc_adc_inj_result_t.
+ * @{
+ */
+#define ADC_CH_COUNT                (12u)
+/**
+ * @}
+ */
+
 /*******************************************************************************
  * Global type definitions ('typedef')
  ******************************************************************************/
@@ -134,6 +144,137 @@ typedef struct
     uint16_t u16Dr1;            /*!< Threshold value to register ADC_AWD0DR1/ADC_AWD1DR1. */
 } stc_awd_cfg_t;
 
+/**
+ * @brief Structure definition of AWD(analog watchdog) monitor configuration.
+ */
+typedef struct
+{
+    stc_awd_cfg_t astcAwd[2u];  /*!< Configuration of AWD0 and AWD1. */
+    uint8_t  u8AwdEn;           /*!< The AWDs to be enabled, ADC_FLAG_AWD0 and/or ADC_FLAG_AWD1.
+                                     Both in combination mode. */
+    uint16_t u16CombMode;       /*!< Combination mode.
+                                     This parameter can be a value of @ref ADC_AWD_Combination_Mode */
+} stc_adc_awd_monitor_cfg_t;
+
+/**
+ * @brief Structure definition of AWD(analog watchdog) monitor statistics.
+ */
+typedef struct
+{
+    __IO uint32_t au32Cnt[2u];  /*!< Number of events of AWD0 and AWD1, not counted in combination mode. */
+    __IO uint32_t u32CombCnt;   /*!< Number of events of the combination. */
+    __IO uint16_t au16Min[2u];  /*!< Minimum value that raised an event of AWD0 and AWD1, not updated in
+                                     combination mode. */
+    __IO uint16_t au16Max[2u];  /*!< Maximum value that raised an event of AWD0 and AWD1, not updated in
+                                     combination mode. */
+} stc_adc_awd_stat_t;
+
+/**
+ * @brief AWD(analog watchdog) monitor event callback.
+ * @param  [in]  u8Flag             The flags of the event, values of @ref ADC_AWD_State_Flag
+ * @param  [in]  pstcStat           The statistics just updated.
+ */
+typedef void (*func_ptr_adc_awd_t)(uint8_t u8Flag, const stc_adc_awd_stat_t *pstcStat);
+
+/**
+ * @brief ADC stream block callback.
+ * @param  [in]  pu16Block          The demultiplexed block, the u16Scans samples of
+ *                                  the n-th channel(ascending channel number) start
+ *                                  at pu16Block[n * u16Scans].
+ * @param  [in]  u16Scans           Number of scans in the block.
+ */
+typedef void (*func_ptr_adc_stream_t)(const uint16_t *pu16Block, uint16_t u16Scans);
+
+/**
+ * @brief Structure definition of ADC stream configuration.
+ */
+typedef struct
+{
+    uint16_t u16Channel;        /*!< Channels of sequence A.
+                                     This parameter can be values of @ref ADC_Channels */
+    uint16_t u16ScanConvMode;   /*!< ADC_MODE_SA_SINGLE: each trigger event starts one scan.
+                                     ADC_MODE_SA_CONTINUOUS: the first trigger event starts
+                                     back to back scans. */
+    en_event_src_t enTrgEvent;  /*!< Trigger event of sequence A, such as EVT_TMR4_SCMUH ~ EVT_TMR4_SCMWL,
+                                     EVT_TMRA_OVF, EVT_TMRA_UDF or EVT_TMRA_CMP. */
+    uint8_t  u8DmaCh;           /*!< DMA channel, DMA_CHANNEL_0 or DMA_CHANNEL_1. */
+    uint16_t u16BlockScans;     /*!< Scans per block, 1 ~ 1023. */
+    uint16_t *pu16Ring;         /*!< Ring buffer of 2 * u16BlockScans * (highest channel number -
+                                     lowest channel number + 1) half words. */
+    uint16_t *pu16Demux;        /*!< Block buffer of u16BlockScans * (number of channels) half words. */
+    func_ptr_adc_stream_t pfnBlock; /*!< Called in the DMA IRQ for every block. */
+} stc_adc_stream_cfg_t;
+
+/**
+ * @brief Structure definition of ADC oversampling configuration.
+ */
+typedef struct
+{
+    uint16_t u16Ratio;          /*!< Oversampling ratio, 4 ~ 256. */
+    uint8_t  u8Shift;           /*!< Right shift of the decimated value. 4^n samples give n more bits,
+                                     e.g. ratio 16 and shift 2 give 14 bits, ratio 256 and shift 4
+                                     give 16 bits. The CIC filter needs log2(ratio) more shift. */
+    uint8_t  u8Filter;          /*!< Decimation filter.
+                                     This parameter can be a value of @ref ADC_Ovs_Filter */
+} stc_adc_ovs_cfg_t;
+
+/**
+ * @brief Structure definition of ADC oversampling state of one channel.
+ */
+typedef struct
+{
+    uint32_t u32Acc;            /*!< Accumulator, or the first integrator of CIC. */
+    uint32_t u32Int2;           /*!< The second integrator of CIC. */
+    uint32_t u32Comb1;          /*!< The first comb delay of CIC. */
+    uint32_t u32Comb2;          /*!< The second comb delay of CIC. */
+    uint32_t au32Ma[4u];        /*!< History of the moving average. */
+    uint32_t u32MaSum;          /*!< Sum of the history. */
+    uint16_t u16Ratio;          /*!< Oversampling ratio. */
+    uint16_t u16Cnt;            /*!< Samples accumulated for the current output. */
+    uint8_t  u8Shift;           /*!< Right shift of the decimated value. */
+    uint8_t  u8Filter;          /*!< Decimation filter. */
+    uint8_t  u8MaIdx;           /*!< Oldest entry of the history. */
+} stc_adc_ovs_t;
+
+/**
+ * @brief Structure definition of ADC injected sampling configuration.
+ */
+typedef struct
+{
+    uint16_t u16Channel;        /*!< Channels of sequence B.
+                                     This parameter can be values of @ref ADC_Channels */
+    uint32_t u32SevtCh;         /*!< Timer4 special event channel, TIMER4_SEVT_UH ~ TIMER4_SEVT_WL. The
+                                     event of the same name(EVT_TMR4_SCMUH ~ EVT_TMR4_SCMWL) is used. */
+    uint16_t u16SccrVal;        /*!< Timer4 count value of the sampling point. */
+    uint16_t u16Match;          /*!< Counting conditions of the sampling point.
+                                     This parameter can be values of @ref ADC_Inj_Match */
+} stc_adc_inj_cfg_t;
+
+/**
+ * @brief Structure definition of ADC injected sampling result.
+ */
+typedef struct
+{
+    __IO uint32_t u32Count;     /*!< Number of completed conversions of sequence B. */
+    __IO uint16_t au16Data[ADC_CH_COUNT]; /*!< Data of the channels of sequence B, in ascending channel order. */
+} stc_adc_inj_result_t;
+
+/**
+ * @brief Structure definition of ADC calibration.
+ */
+typedef struct
+{
+    uint32_t u32Gain;           /*!< Millivolts per LSB in Q16. */
+    uint16_t u16Offset;         /*!< Raw value of 0mV. */
+    uint16_t u16RefRaw;         /*!< Raw value of the internal reference of the last update. */
+} stc_adc_cal_t;
+
+/**
+ * @brief ADC injected sampling callback.
+ * @param  [in]  pstcResult         The result just updated.
+ */
+typedef void (*func_ptr_adc_inj_t)(const stc_adc_inj_result_t *pstcResult);
+
 /**
  * @}
  */
@@ -286,15 +427,6 @@ typedef struct
  * @}
  */
 
-/**
- * @defgroup ADC_Channel_Count ADC Channel Count
- * @{
- */
-#define ADC_CH_COUNT                (12u)
-/**
- * @}
- */
-
 /**
  * @defgroup ADC_Channels ADC Common Channels
  * @{
@@ -354,6 +486,30 @@ typedef struct
  * @}
  */
 
+/**
+ * @defgroup ADC_Inj_Match ADC Injected Sampling Match Condition
+ * @{
+ */
+#define ADC_INJ_MATCH_UP            ((uint16_t)0x01u)   /*!< Timer4 counts up and matches u16SccrVal. */
+#define ADC_INJ_MATCH_DOWN          ((uint16_t)0x02u)   /*!< Timer4 counts down and matches u16SccrVal. */
+#define ADC_INJ_MATCH_PEAK          ((uint16_t)0x04u)   /*!< Timer4 matches u16SccrVal at the peak. */
+#define ADC_INJ_MATCH_ZERO          ((uint16_t)0x08u)   /*!< Timer4 matches u16SccrVal at zero. */
+/**
+ * @}
+ */
+
+/**
+ * @defgroup ADC_Ovs_Filter ADC Oversampling Decimation Filter
+ * @{
+ */
+#define ADC_OVS_FILTER_NONE         ((uint8_t)0x0u)     /*!< Sum of 'ratio' samples(accumulate and dump). */
+#define ADC_OVS_FILTER_CIC          ((uint8_t)0x1u)     /*!< 2nd order CIC, gain is ratio^2. */
+#define ADC_OVS_FILTER_MA           ((uint8_t)0x2u)     /*!< Sum of 'ratio' samples, then moving average
+                                                             of the last 4 decimated values. */
+/**
+ * @}
+ */
+
 /**
  * @}
  */
@@ -431,6 +587,34 @@ void ADC_AwdClrFlag(uint8_t u8Flag);
 
 void ADC_OpaCmd(uint8_t u8OpaNbr, en_functional_state_t enNewState);
 
+en_result_t ADC_AwdMonitorStart(const stc_adc_awd_monitor_cfg_t *pstcCfg,
+                                stc_adc_awd_stat_t *pstcStat,
+                                func_ptr_adc_awd_t pfnEvent);
+void ADC_AwdMonitorStop(void);
+void ADC_AwdMonitorIrqHandler(void);
+
+en_result_t ADC_StreamStart(const stc_adc_stream_cfg_t *pstcCfg);
+void ADC_StreamStop(void);
+void ADC_StreamDmaIrqHandler(void);
+
+en_result_t ADC_InjStart(const stc_adc_inj_cfg_t *pstcCfg,
+                         stc_adc_inj_result_t *pstcResult,
+                         func_ptr_adc_inj_t pfnCplt);
+void ADC_InjStop(void);
+en_result_t ADC_InjSetPhase(uint16_t u16SccrVal);
+void ADC_InjIrqHandler(void);
+
+en_result_t ADC_CalUpdate(stc_adc_cal_t *pstcCal, uint32_t u32RefRaw,
+                          uint16_t u16ZeroRaw, uint16_t u16VintMv);
+en_result_t ADC_CalMeasure(stc_adc_cal_t *pstcCal, uint16_t u16ZeroRaw,
+                           uint16_t u16VintMv, uint32_t u32Timeout);
+en_result_t ADC_CalApply(const stc_adc_cal_t *pstcCal, const uint16_t *pu16Raw,
+                         uint16_t *pu16Mv, uint16_t u16Len);
+
+en_result_t ADC_OvsInit(stc_adc_ovs_t *pstcOvs, const stc_adc_ovs_cfg_t *pstcCfg);
+uint16_t ADC_OvsProcess(stc_adc_ovs_t *pstcOvs, const uint16_t *pu16In,
+                        uint16_t u16Len, uint16_t *pu16Out);
+
 /**
  * @}
  */
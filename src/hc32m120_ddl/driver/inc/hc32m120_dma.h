@@ -290,6 +290,7 @@ typedef struct
 void DMA_Cmd(en_functional_state_t enNewState);
 void DMA_ChannelEnable(uint8_t u8Ch);
 void DMA_ChannelDisable(uint8_t u8Ch);
+en_functional_state_t DMA_GetChannelState(uint8_t u8Ch);
 void DMA_ErrIrqCmd(uint8_t u8Ch, uint32_t u32Irq, en_functional_state_t enNewState);
 void DMA_CplIrqCmd(uint8_t u8Ch, uint32_t u32Irq, en_functional_state_t enNewState);
 
@@ -298,6 +299,12 @@ void DMA_ChannelCfg(uint8_t u8Ch, const stc_dma_ch_cfg_t* pstcChCfg);
 void DMA_RepeatInit(uint8_t u8Ch, uint32_t u32RptSel, uint32_t u32Cnt);
 void DMA_NonSeqInit(uint8_t u8Ch, uint32_t u32NSeqSel, uint32_t u32Offset, uint32_t u32Cnt);
 void DMA_LlpInit(uint8_t u8Ch, uint32_t u32LlpRun, uint32_t u32Llp);
+void DMA_LlpCmd(uint8_t u8Ch, en_functional_state_t enNewState);
+void DMA_RptNSeqCmd(uint8_t u8Ch, en_functional_state_t enNewState);
+void DMA_LlpDescInit(stc_dma_llp_descriptor_t *pstcDesc,
+                     const stc_dma_ch_cfg_t *pstcChCfg,
+                     uint32_t u32LlpRun,
+                     const stc_dma_llp_descriptor_t *pstcNext);
 
 void DMA_SetSrcAddress(uint8_t u8Ch, uint32_t u32Address);
 void DMA_SetDesAddress(uint8_t u8Ch, uint32_t u32Address);
@@ -95,6 +95,90 @@ typedef struct
     uint32_t u32SclTime;     /*!< The SCL rising and falling time, count of T(hclk)*/
 }stc_i2c_init_t;
 
+/**
+ * @brief I2C baudrate solved by I2C_BaudrateCalc()
+ */
+typedef struct
+{
+    uint32_t u32I2cClkDiv;   /*!< I2C clock division for hclk @ref I2C_Clock_division */
+    uint32_t u32SclLowW;     /*!< SCL low level width, value of CCR.SLOWW */
+    uint32_t u32SclHighW;    /*!< SCL high level width, value of CCR.SHIGHW */
+    uint32_t u32Baudrate;    /*!< Actual baudrate, not higher than the target */
+}stc_i2c_baud_t;
+
+/**
+ * @brief I2C bus pins used by I2C_BusRecover()
+ */
+typedef struct
+{
+    uint8_t u8SclPort;       /*!< SCL port, GPIO_PORT_x */
+    uint8_t u8SclPin;        /*!< SCL pin, GPIO_PIN_x */
+    uint8_t u8SdaPort;       /*!< SDA port, GPIO_PORT_x */
+    uint8_t u8SdaPin;        /*!< SDA pin, GPIO_PIN_x */
+}stc_i2c_bus_pin_t;
+
+/**
+ * @brief I2C master transaction structure
+ * @note  The write phase is sent first, then the read phase follows with a
+ *        repeated start. Either phase can be omitted by setting its length
+ *        to 0, both 0 only checks if the slave acknowledges its address.
+ */
+typedef struct
+{
+    uint8_t         u8SlaveAdr;     /*!< 7-bit slave address */
+    const uint8_t   *pu8TxBuf;      /*!< Data of the write phase, such as register address */
+    uint16_t        u16TxLen;       /*!< Length of the write phase */
+    uint8_t         *pu8RxBuf;      /*!< Buffer of the read phase */
+    uint16_t        u16RxLen;       /*!< Length of the read phase */
+}stc_i2c_master_xfer_t;
+
+/**
+ * @brief I2C master transaction complete callback type
+ * @note  enResult is Ok, Error(NACK or arbitration lost) or ErrorTimeout.
+ */
+typedef void (*func_ptr_i2c_cplt_t)(en_result_t enResult);
+
+/**
+ * @brief I2C master register access job structure
+ */
+typedef struct
+{
+    uint8_t             u8SlaveAdr; /*!< 7-bit slave address */
+    uint8_t             u8Reg;      /*!< Register address sent first */
+    uint8_t             u8Dir;      /*!< Access direction, @ref I2C_Job_Direction */
+    uint16_t            u16Len;     /*!< Length of data read from or written to the register */
+    uint8_t             *pu8Buf;    /*!< Data buffer */
+    __IO en_result_t    enResult;   /*!< Result of the job, written by the driver */
+}stc_i2c_job_t;
+
+/**
+ * @brief I2C slave register map read callback type
+ * @note  Called in the ISR when the master starts reading from u8Reg, before
+ *        the first byte is loaded. Keep it short, SCL is stretched meanwhile.
+ */
+typedef void (*func_ptr_i2c_slave_rd_t)(uint8_t u8Reg);
+
+/**
+ * @brief I2C slave register map write callback type
+ * @note  Called in the ISR after the master has written u16Len registers
+ *        from u8Reg (wrapping at the end of the map), on stop or restart.
+ */
+typedef void (*func_ptr_i2c_slave_wr_t)(uint8_t u8Reg, uint16_t u16Len);
+
+/**
+ * @brief I2C slave register map structure
+ * @note  The first byte written after the address is the register pointer,
+ *        the pointer is auto-incremented by every byte read or written and
+ *        wraps at u16RegNum.
+ */
+typedef struct
+{
+    uint8_t                 *pu8Reg;    /*!< Register file in RAM */
+    uint16_t                u16RegNum;  /*!< Number of registers, 1 ~ 256 */
+    func_ptr_i2c_slave_rd_t pfnRead;    /*!< Read callback, NULL: not used */
+    func_ptr_i2c_slave_wr_t pfnWrite;   /*!< Write callback, NULL: not used */
+}stc_i2c_slave_regmap_t;
+
 /**
  * @}
  */
@@ -176,6 +260,24 @@ typedef struct
  * @}
  */
 
+/** @defgroup I2C_Job_Direction I2C job direction
+  * @{
+  */
+#define     I2C_JOB_DIR_WRITE       0u
+#define     I2C_JOB_DIR_READ        1u
+/**
+ * @}
+ */
+
+/** @defgroup I2C_Smbus_Protocol I2C SMBus protocol
+  * @{
+  */
+#define     I2C_SMBUS_BLOCK_MAX             32u     /*!< Max byte count of the block read and write */
+#define     I2C_SMBUS_ALERT_RESPONSE_ADR    0x0Cu   /*!< Alert response address (0001 100b) */
+/**
+ * @}
+ */
+
 /** @defgroup I2C_Adr_Num I2C address index number
   * @{
   */
@@ -232,7 +334,11 @@ __STATIC_INLINE void I2C_GenerateStop(void)
 }
 
 en_result_t I2C_BaudrateConfig(const stc_i2c_init_t* pstcI2C_InitStruct, float32_t *pf32Err);
+en_result_t I2C_BaudrateCalc(uint32_t u32Baudrate, uint32_t u32SclTimeNs, stc_i2c_baud_t *pstcBaud);
+en_result_t I2C_BaudrateAutoConfig(uint32_t u32Baudrate, uint32_t u32SclTimeNs, stc_i2c_baud_t *pstcBaud);
 void I2C_DeInit(void);
+en_result_t I2C_WaitBusIdle(uint32_t u32TimeoutUs);
+en_result_t I2C_BusRecover(const stc_i2c_bus_pin_t *pstcPin);
 en_result_t I2C_Init(const stc_i2c_init_t* pstcI2C_InitStruct, float32_t *pf32Err);
 void I2C_Cmd(en_functional_state_t enNewState);
 void I2C_SmbusConfig(uint32_t SmbusConfig);
@@ -255,6 +361,46 @@ en_flag_status_t I2C_GetStatus(uint32_t u32StatusBit);
 void I2C_WriteStatus(uint32_t u32StatusBit, en_flag_status_t enStatus);
 void I2C_ClearStatus(uint32_t u32StatusBit);
 
+en_result_t I2C_MasterXferStart(const stc_i2c_master_xfer_t *pstcXfer,
+                                uint32_t u32Timeout,
+                                func_ptr_i2c_cplt_t pfnCplt);
+en_result_t I2C_MasterQueueStart(stc_i2c_job_t *pstcJobs,
+                                 uint16_t u16JobNum,
+                                 uint32_t u32Timeout,
+                                 func_ptr_i2c_cplt_t pfnBatchCplt);
+void I2C_MasterIrqHandler(void);
+void I2C_MasterTimeoutTick(void);
+en_result_t I2C_MasterAbort(void);
+en_result_t I2C_MasterGetResult(void);
+en_result_t I2C_MasterDmaCmd(uint8_t u8DmaCh, en_functional_state_t enNewState);
+void I2C_MasterDmaIrqHandler(void);
+
+en_result_t I2C_SmbusPecCmd(en_functional_state_t enNewState);
+en_result_t I2C_SmbusBlockWrite(uint8_t u8SlaveAdr,
+                                uint8_t u8Cmd,
+                                const uint8_t *pu8Data,
+                                uint8_t u8Count,
+                                uint32_t u32Timeout,
+                                func_ptr_i2c_cplt_t pfnCplt);
+en_result_t I2C_SmbusBlockRead(uint8_t u8SlaveAdr,
+                               uint8_t u8Cmd,
+                               uint8_t *pu8Block,
+                               uint32_t u32Timeout,
+                               func_ptr_i2c_cplt_t pfnCplt);
+en_result_t I2C_SmbusProcessCall(uint8_t u8SlaveAdr,
+                                 uint8_t u8Cmd,
+                                 uint16_t u16Data,
+                                 uint8_t *pu8Result,
+                                 uint32_t u32Timeout,
+                                 func_ptr_i2c_cplt_t pfnCplt);
+en_result_t I2C_SmbusAlertQuery(uint8_t *pu8Adr, uint32_t u32Timeout, func_ptr_i2c_cplt_t pfnCplt);
+en_result_t I2C_SmbusAlertRaise(uint8_t u8OwnAdr, func_ptr_i2c_cplt_t pfnCplt);
+void I2C_SmbusAlertIrqHandler(void);
+
+en_result_t I2C_SlaveRegMapStart(uint32_t u32AdrNum, const stc_i2c_slave_regmap_t *pstcMap);
+void I2C_SlaveRegMapStop(uint32_t u32AdrNum);
+void I2C_SlaveIrqHandler(void);
+
 /**
  * @}
  */
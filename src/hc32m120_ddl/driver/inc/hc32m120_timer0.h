@@ -112,6 +112,26 @@ typedef struct
                                          This value can be set 0-0xFFFF */
 }stc_tim0_init_t;
 
+/**
+ * @brief Timer0 software timer structure definition
+ * @note  The structure is owned by the application and linked into the
+ *        timer wheel while pending; pstcNext, ppstcPrev and u32Expire are
+ *        internal.
+ */
+typedef struct stc_timer0_swt
+{
+    struct stc_timer0_swt  *pstcNext;   /*!< Next timer in the same slot */
+
+    struct stc_timer0_swt **ppstcPrev;  /*!< Link pointing to this timer, NULL when not pending */
+
+    uint32_t       u32Expire;         /*!< Expiry time in ticks */
+
+    uint32_t       u32Period;         /*!< Reload period in ticks, 0 for one-shot,
+                                         This value can be set 0-TIMER0_SWT_TICK_MAX */
+
+    func_ptr_t     pfnCallback;       /*!< Function called on expiry from TIMER0_SWT_IrqHandler() */
+}stc_timer0_swt_t;
+
 /**
  * @}
  */
@@ -170,6 +190,14 @@ typedef struct
 #define TIMER0_BT_HWTRG_FUNC_STOP   (TMR0_BCONR_HSTPA)
 #define TIMER0_BT_HWTRG_FUNC_NONE   (0x00000000ul)
 
+/**
+ * @}
+ */
+
+/** @defgroup TIMER0_Software_Timer_define TIMER0 software timer define
+ * @{
+ */
+#define TIMER0_SWT_TICK_MAX         (0x00FF0000ul)  /*!< Maximum delay and period in ticks */
 /**
  * @}
  */
@@ -206,6 +234,12 @@ en_result_t TIMER0_WriteCmpReg(uint16_t u16Cnt);
 
 void TIMER0_SetTriggerSrc(en_event_src_t enEvent);
 
+en_result_t TIMER0_SWT_Init(void);
+en_result_t TIMER0_SWT_Start(stc_timer0_swt_t *pstcTimer, uint32_t u32Delay);
+void TIMER0_SWT_Stop(stc_timer0_swt_t *pstcTimer);
+en_flag_status_t TIMER0_SWT_IsPending(const stc_timer0_swt_t *pstcTimer);
+void TIMER0_SWT_IrqHandler(void);
+
 /**
  * @}
  */
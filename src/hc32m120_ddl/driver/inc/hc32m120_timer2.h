@@ -128,6 +128,21 @@ typedef struct
                                                  This parameter can be a value of @ref en_functional_state_t */
 } stc_timer2_config_t;
 
+/**
+ * @brief TIMER2 wake-up scheduler initialization structure.
+ */
+typedef struct
+{
+    uint16_t u16ClkSource;                  /*!< Specify the asynchronous clock source for the scheduler.
+                                                 This parameter can be TIMER2_ASYNC_CS_LRC or TIMER2_ASYNC_CS_CLKA */
+
+    uint16_t u16ClkPrescaler;               /*!< Specify the prescaler of the clock source.
+                                                 This parameter can be a value of @ref TIMER2_Clock_Prescaler */
+
+    uint32_t u32ClkFreq;                    /*!< Specify the nominal frequency(Hz) of the clock source, e.g. LRC_VALUE.
+                                                 This parameter can be a value between 1 and TIMER2_WAKE_CLK_FREQ_MAX */
+} stc_timer2_wake_init_t;
+
 /**
  * @}
  */
@@ -286,6 +301,17 @@ typedef struct
  * @}
  */
 
+/**
+ * @defgroup TIMER2_Wake_Scheduler_Limits TIMER2 Wake-up Scheduler Limits
+ * @{
+ */
+#define TIMER2_WAKE_CLK_FREQ_MAX        (2000000ul)                             /*!< Max. nominal asynchronous clock frequency(Hz). */
+#define TIMER2_WAKE_PPM_MAX             (200000l)                               /*!< Max. absolute clock error compensation(ppm). */
+#define TIMER2_WAKE_CAL_TICKS_MAX       ((uint16_t)0xFF00u)                     /*!< Max. counter ticks of one calibration. */
+/**
+ * @}
+ */
+
 /**
  * @}
  */
@@ -374,6 +400,22 @@ void TIMER2_SetTrigEvent(en_event_src_t enEvent);
 en_flag_status_t TIMER2_GetFlag(uint16_t u16Flag);
 void TIMER2_ClrFlag(uint16_t u16Flag);
 
+en_result_t TIMER2_WAKE_StructInit(stc_timer2_wake_init_t *pstcInit);
+en_result_t TIMER2_WAKE_Init(const stc_timer2_wake_init_t *pstcInit);
+en_result_t TIMER2_WAKE_SetCompensation(int32_t i32Ppm);
+int32_t TIMER2_WAKE_GetCompensation(void);
+#if (DDL_UTILITY_ENABLE == DDL_ON)
+en_result_t TIMER2_WAKE_Calibrate(uint32_t u32HclkFreq, uint16_t u16Ticks);
+#endif /* DDL_UTILITY_ENABLE */
+uint32_t TIMER2_WAKE_TimeToTicks(uint32_t u32TimeUs);
+en_result_t TIMER2_WAKE_Start(uint32_t u32TimeUs);
+void TIMER2_WAKE_Stop(void);
+en_flag_status_t TIMER2_WAKE_IsExpired(void);
+#if (DDL_PWC_ENABLE == DDL_ON)
+en_flag_status_t TIMER2_WAKE_EnterStopMode(void);
+#endif /* DDL_PWC_ENABLE */
+void TIMER2_WAKE_IrqHandler(void);
+
 /**
  * @}
  */
@@ -344,6 +344,32 @@ typedef struct
                                                          This structure details refer @ref stc_timer4_sevt_trigger_cond_t */
 } stc_timer4_sevt_init_t;
 
+/**
+ * @brief Timer4 three-phase inverter (OCO UL/VL/WL + PWM U/V/W) initialization configuration
+ */
+typedef struct
+{
+    uint16_t u16CycleVal;                   /*!< Peak value of the triangular count, the PWM period is 2 * u16CycleVal count clocks.
+                                                 This parameter can be a value of half-word */
+
+    uint16_t u16CntClkDiv;                  /*!< Count clock division
+                                                 This parameter can be a value of @ref TIMER4_CNT_Clock_Division */
+
+    uint16_t u16PwmClkDiv;                  /*!< Clock division of the dead timer
+                                                 This parameter can be a value of @ref TIMER4_PWM_Clock_Division */
+
+    uint16_t u16DeadTime;                   /*!< Dead time inserted on both edges, in dead timer clocks.
+                                                 This parameter can be a value of half-word */
+
+    uint16_t u16OccrBufMode;                /*!< Moment at which the staged compare values take effect
+                                                 This parameter can be a value of @ref TIMER4_OCO_OCCR_Buffer_Mode */
+} stc_timer4_inv_init_t;
+
+/**
+ * @brief Timer4 scheduler task callback
+ */
+typedef void (*func_ptr_timer4_sched_t)(void);
+
 /**
  * @}
  */
@@ -541,7 +567,7 @@ typedef struct
  */
 #define TIMER4_OCO_OP_HOLD                      ((uint16_t)0x0000u)                           /*!< Hold output when the TIMER4 OCO count match */
 #define TIMER4_OCO_OP_HIGH                      (TMR4_OCMRH_OPDCH_0 >> TMR4_OCMRH_OPDCH_POS)  /*!< Output high when the TIMER4 OCO count match */
-#define TIMER4_OCO_OP_LOW                       (TMR4_OCMRH_OPDCH_0 >> TMR4_OCMRH_OPDCH_POS)  /*!< Output low when the TIMER4 OCO count match */
+#define TIMER4_OCO_OP_LOW                       (TMR4_OCMRH_OPDCH_1 >> TMR4_OCMRH_OPDCH_POS)  /*!< Output low when the TIMER4 OCO count match */
 #define TIMER4_OCO_OP_INVERT                    (TMR4_OCMRH_OPDCH >> TMR4_OCMRH_OPDCH_POS)    /*!< Invert output when the TIMER4 OCO count match */
 /**
  * @}
@@ -736,6 +762,15 @@ typedef struct
  * @}
  */
 
+/**
+ * @defgroup TIMER4_SCHED_Macros TIMER4 Scheduler Macros
+ * @{
+ */
+#define TIMER4_SCHED_TASK_MAX                   (4u)        /*!< Maximum number of scheduler tasks */
+/**
+ * @}
+ */
+
 /**
  * @}
  */
@@ -986,6 +1021,18 @@ en_result_t TIMER4_SEVT_SetMaskTimes(uint32_t u32Ch,
 uint16_t TIMER4_SEVT_GetMaskTimes(uint32_t u32Ch);
 void TIMER4_EMB_SetPwmPortPolarity(uint32_t u32PortPolarity);
 uint32_t TIMER4_EMB_GetPwmPortPolarity(void);
+en_result_t TIMER4_INV_Init(const stc_timer4_inv_init_t *pstcInit);
+void TIMER4_INV_SetCompare(uint16_t u16CmpU, uint16_t u16CmpV, uint16_t u16CmpW);
+void TIMER4_INV_Stage(uint16_t u16CmpU, uint16_t u16CmpV, uint16_t u16CmpW);
+en_result_t TIMER4_INV_Commit(uint16_t u16Guard);
+en_flag_status_t TIMER4_INV_GetCommitStatus(void);
+en_result_t TIMER4_SCHED_AddTask(uint16_t u16Divisor,
+                                func_ptr_timer4_sched_t pfnTask);
+en_result_t TIMER4_SCHED_AddEvent(uint32_t u32Ch, uint16_t u16Divisor);
+en_result_t TIMER4_SCHED_Start(void);
+void TIMER4_SCHED_Stop(void);
+void TIMER4_SCHED_IrqHandler(void);
+uint8_t TIMER4_INV_Svpwm(int16_t i16Alpha, int16_t i16Beta);
 
 /**
  * @}
@@ -184,6 +184,54 @@ typedef struct
                                              This parameter can be any value of @ref TIMERA_IC_Condition */
 } stc_timera_ic_init_t;
 
+/**
+ * @brief TimerA quadrature encoder initialization structure definition
+ */
+typedef struct
+{
+    uint16_t u16EncMode;                /*!< Specifies the counted edges of the TIMA_<t>_CLKA/CLKB(A/B) phases.
+                                             This parameter can be a value of @ref TIMERA_ENC_Mode */
+
+    en_functional_state_t enFilterCmd;  /*!< Enable or disable the noise filter of the A/B phases and the index input.
+                                             This parameter can be a value of @ref en_functional_state_t */
+
+    uint16_t u16ClkAFilterClkDiv;       /*!< Specifies the A phase noise filter clock division.
+                                             This parameter can be a value of @ref TIMERA_CLKA_Port_Filter_Clock_Division */
+
+    uint16_t u16ClkBFilterClkDiv;       /*!< Specifies the B phase noise filter clock division.
+                                             This parameter can be a value of @ref TIMERA_CLKB_Port_Filter_Clock_Division */
+
+    uint8_t  u8IndexCh;                 /*!< Specifies the channel whose TIMA_<t>_PWMn pin receives the index(Z) pulse.
+                                             This parameter can be a value of @ref en_timera_channel_t or TIMERA_ENC_INDEX_NONE */
+
+    uint16_t u16IndexFilterClkDiv;      /*!< Specifies the index input noise filter clock division.
+                                             This parameter can be a value of @ref TIMERA_IC_PWM_Port_Filter_Clock_Division */
+
+    uint32_t u32TickFreq;               /*!< Frequency(Hz) of the time stamps passed to TIMERA_ENC_GetSpeed(). */
+
+    uint32_t u32MinCount;               /*!< Edge count that closes a speed window. */
+
+    uint32_t u32MaxWindow;              /*!< Longest speed window in ticks, speed reads 0 when no edge arrives within it. */
+} stc_timera_enc_init_t;
+
+/**
+ * @brief TimerA DMA-fed PWM waveform configuration structure definition
+ */
+typedef struct
+{
+    uint8_t  u8Channel;                 /*!< Specifies the PWM channel whose compare value is streamed.
+                                             This parameter can be a value of @ref en_timera_channel_t */
+
+    uint8_t  u8DmaCh;                   /*!< Specifies the DMA channel, DMA_CHANNEL_0 or DMA_CHANNEL_1. */
+
+    const uint16_t *pu16Table;          /*!< Compare value of each PWM period. */
+
+    uint16_t u16Len;                    /*!< Number of entries in pu16Table, 1 ~ 1023. */
+
+    en_functional_state_t enLoop;       /*!< Enable: replay pu16Table endlessly. Disable: play it once.
+                                             This parameter can be a value of @ref en_functional_state_t */
+} stc_timera_wave_cfg_t;
+
 /**
  * @brief TimerA channel enumeration
  */
@@ -549,6 +597,27 @@ typedef enum
  * @}
  */
 
+/**
+ * @defgroup TIMERA_ENC_Mode TimerA Encoder Mode
+ * @note Phase A leading phase B counts up.
+ * @{
+ */
+#define TIMERA_ENC_MODE_X1                      ((uint16_t)0x0001u)     /*!< Count the rising edges of phase A */
+#define TIMERA_ENC_MODE_X2                      ((uint16_t)0x0002u)     /*!< Count both edges of phase A */
+#define TIMERA_ENC_MODE_X4                      ((uint16_t)0x0004u)     /*!< Count both edges of phase A and B */
+/**
+ * @}
+ */
+
+/**
+ * @defgroup TIMERA_ENC_Index_None TimerA Encoder No Index Input
+ * @{
+ */
+#define TIMERA_ENC_INDEX_NONE                   ((uint8_t)0xFFu)        /*!< No index(Z) pulse input */
+/**
+ * @}
+ */
+
 /**
  * @defgroup TIMERA_Hardware_Count_Down_Condition TimerA Hardware Count Down Condition
  * @note TIMA_<t>_TRIG or TIMA_<t>_CLKA or TIMA_<t>_CLKB t is unit number,value is 1.
@@ -681,6 +750,20 @@ void TIMERA_ClearFlag(M0P_TMRA_TypeDef *TMRAx, uint16_t u16Flag);
 void TIMERA_IntCmd(M0P_TMRA_TypeDef *TMRAx, uint16_t u16IntSource,
                    en_functional_state_t enNewSta);
 
+/* Quadrature encoder functions */
+en_result_t TIMERA_ENC_Init(M0P_TMRA_TypeDef *TMRAx,
+                            const stc_timera_enc_init_t *pstcEncInit);
+int32_t TIMERA_ENC_GetPosition(M0P_TMRA_TypeDef *TMRAx);
+en_result_t TIMERA_ENC_GetIndex(M0P_TMRA_TypeDef *TMRAx, int32_t *pi32Pos,
+                                uint32_t *pu32Cnt);
+int32_t TIMERA_ENC_GetSpeed(M0P_TMRA_TypeDef *TMRAx, uint32_t u32Now);
+void TIMERA_ENC_IrqHandler(M0P_TMRA_TypeDef *TMRAx);
+
+/* DMA-fed PWM waveform functions */
+en_result_t TIMERA_WAVE_Start(M0P_TMRA_TypeDef *TMRAx,
+                              const stc_timera_wave_cfg_t *pstcCfg);
+void TIMERA_WAVE_Stop(M0P_TMRA_TypeDef *TMRAx, uint8_t u8DmaCh);
+
 /**
  * @}
  */
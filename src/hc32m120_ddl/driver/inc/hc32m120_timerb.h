@@ -160,6 +160,33 @@ typedef struct
                                              This parameter can be a value of @ref TIMERB_Input_Capture_Condition */
 } stc_timerb_ic_init_t;
 
+/**
+ * @brief TimerB 32-bit cascade initialization structure definition
+ */
+typedef struct
+{
+    uint16_t u16ClkDiv;                 /*!< Count clock division of the odd(low half-word) unit.
+                                             This parameter can be a value of @ref TIMERB_ClockDivision */
+
+    uint16_t u16CaptureCondition;       /*!< Input capture condition of both units, TIMERB_IC_INVALID for counting only.
+                                             This parameter can be a value of @ref TIMERB_Input_Capture_Condition */
+
+    uint16_t u16NoiseFilterClkDiv;      /*!< Input capture noise filter clock division of both units.
+                                             This parameter can be a value of @ref TIMERB_Input_Capture_Noise_Filter_Clock_Division */
+} stc_timerb_cascade_init_t;
+
+/**
+ * @brief TimerB capture meter result structure definition
+ */
+typedef struct
+{
+    uint32_t u32Freq;                   /*!< Input frequency in mHz, averaged over the window. */
+
+    uint16_t u16Duty;                   /*!< High level duty in 0.01%, 0 ~ 10000. */
+
+    uint16_t u16PeriodNum;              /*!< Number of whole input periods in the window. */
+} stc_timerb_meter_result_t;
+
 /**
  * @}
  */
@@ -796,6 +823,25 @@ void TIMERB_OC_SetForceOutputPolarity(M0P_TMRB_TypeDef *TMRBx,
                                                 uint16_t u16Polarity);
 uint16_t TIMERB_OC_GetForceOutputPolarity(M0P_TMRB_TypeDef *TMRBx);
 
+/* TimerB 32-bit cascade functions */
+en_result_t TIMERB_CASCADE_Init(M0P_TMRB_TypeDef *TMRBx,
+                                const stc_timerb_cascade_init_t *pstcInit);
+en_result_t TIMERB_CASCADE_StructInit(stc_timerb_cascade_init_t *pstcInit);
+void TIMERB_CASCADE_Start(M0P_TMRB_TypeDef *TMRBx);
+void TIMERB_CASCADE_Stop(M0P_TMRB_TypeDef *TMRBx);
+void TIMERB_CASCADE_SetCounter(M0P_TMRB_TypeDef *TMRBx, uint32_t u32Value);
+uint32_t TIMERB_CASCADE_GetCounter(M0P_TMRB_TypeDef *TMRBx);
+en_result_t TIMERB_CASCADE_GetCapture(M0P_TMRB_TypeDef *TMRBx,
+                                      uint32_t *pu32Value);
+
+/* TimerB DMA capture meter functions */
+en_result_t TIMERB_METER_Start(M0P_TMRB_TypeDef *TMRBx, uint8_t u8DmaCh,
+                               uint16_t *pu16Buf, uint16_t u16Len);
+void TIMERB_METER_Stop(M0P_TMRB_TypeDef *TMRBx, uint8_t u8DmaCh);
+en_result_t TIMERB_METER_Calc(uint8_t u8DmaCh, const uint16_t *pu16Buf,
+                              uint16_t u16Len, uint32_t u32CntClkFreq,
+                              stc_timerb_meter_result_t *pstcResult);
+
 /**
  * @}
  */
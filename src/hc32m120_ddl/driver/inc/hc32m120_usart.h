@@ -203,6 +203,85 @@ typedef struct
                                              This parameter can be a value of @ref USART_HWFLOWCTRL */
 } stc_clksync_init_t;
 
+/**
+ * @brief CLKSYNC chip select function pointer type
+ * @note  The function is called with Enable before the first frame and with
+ *        Disable after the last frame of a transfer.
+ */
+typedef void (*func_ptr_clksync_cs_t)(en_functional_state_t enNewSta);
+
+/**
+ * @brief CLKSYNC transfer handle structure definition
+ */
+typedef struct
+{
+    M0P_USART_TypeDef       *USARTx;        /*!< USART unit working in CLKSYNC mode */
+
+    uint8_t                 u8DmaTxCh;      /*!< DMA channel used for TX in DMA transfer.
+                                                 This parameter can be a value of @ref DMA_Channel_selection */
+
+    uint8_t                 u8DmaRxCh;      /*!< DMA channel used for RX in DMA transfer.
+                                                 This parameter can be a value of @ref DMA_Channel_selection */
+
+    func_ptr_clksync_cs_t   pfnChipSelect;  /*!< Chip select function, NULL if not used */
+
+    func_ptr_t              pfnXferCplt;    /*!< Transfer complete callback of interrupt and DMA transfer, NULL if not used */
+
+    const uint8_t           *pu8TxBuf;      /*!< Pointer to TX buffer, NULL means send USART_CLKSYNC_DUMMY_DATA */
+
+    uint8_t                 *pu8RxBuf;      /*!< Pointer to RX buffer, NULL means discard received data */
+
+    __IO uint16_t           u16TxXferCount; /*!< Count of frames to be transmitted */
+
+    __IO uint16_t           u16RxXferCount; /*!< Count of frames to be received */
+
+    __IO uint16_t           u16RxLostCount; /*!< Count of frames lost by RX overrun in the last transfer,
+                                                 their slots in the RX buffer are skipped */
+
+    __IO en_result_t        enXferResult;   /*!< Result of the last transfer: Ok, Error when frames were lost by RX
+                                                 overrun, ErrorTimeout, ErrorOperationInProgress while busy */
+
+    __IO uint8_t            u8Busy;         /*!< Transfer state, 0: idle, others: busy */
+
+    uint8_t                 u8DmaDummy;     /*!< RX sink of DMA transfer without RX buffer */
+} stc_clksync_handle_t;
+
+/**
+ * @brief USART auto-baud detection handle structure definition
+ */
+typedef struct
+{
+    M0P_USART_TypeDef       *USARTx;        /*!< USART unit to be configured by the detected bit time */
+
+    M0P_TMRB_TypeDef        *TMRBx;         /*!< TimerB unit capturing the falling edges of the RX line on TIMB_<t>_PWM1 */
+
+    func_ptr_t              pfnDetectCplt;  /*!< Detection complete callback, NULL if not used */
+
+    uint16_t                u16FirstEdge;   /*!< Capture value of the start bit falling edge */
+
+    uint16_t                u16PrevEdge;    /*!< Capture value of the previous falling edge */
+
+    uint16_t                u16RefInterval; /*!< Interval between the first two falling edges */
+
+    __IO uint8_t            u8EdgeCount;    /*!< Count of captured falling edges */
+
+    __IO uint8_t            u8Busy;         /*!< Detection state, 0: idle, others: busy */
+
+    __IO uint32_t           u32Baudrate;    /*!< Detected baudrate, 0 if the divisor is out of range */
+} stc_usart_autobaud_handle_t;
+
+/**
+ * @brief USART receive error statistics structure definition
+ */
+typedef struct
+{
+    uint32_t u32ParityErr;              /*!< Count of parity errors */
+    uint32_t u32FramingErr;             /*!< Count of framing errors */
+    uint32_t u32OverrunErr;             /*!< Count of overrun errors */
+    uint32_t u32DroppedBytes;           /*!< Count of received frames discarded or lost because of errors */
+    uint32_t u32RingOverflow;           /*!< Count of received frames lost because the receive buffer of the application was full */
+} stc_usart_err_stat_t;
+
 /**
  * @}
  */
@@ -420,6 +499,29 @@ typedef struct
  * @}
  */
 
+/**
+ * @defgroup USART_CLKSYNC_Transfer USART CLKSYNC Transfer
+ * @{
+ */
+#define USART_CLKSYNC_DUMMY_DATA                (0xFFu)   /*!< Data sent when no TX buffer is specified */
+#define USART_CLKSYNC_DMA_MAX_SIZE              (1023u)   /*!< Max frames of one DMA transfer (DMA_CHxCTL0.CNT) */
+/**
+ * @}
+ */
+
+/**
+ * @defgroup USART_Auto_Baud USART Auto-baud Detection
+ * @note  The sync character 0x55 (LSB first) has falling edges at bit 0, 2, 4,
+ *        6 and 8 of the frame, so five falling edges span eight bit times.
+ * @{
+ */
+#define USART_AUTOBAUD_SYNC_DATA                (0x55u)   /*!< Sync character sent by the remote device */
+#define USART_AUTOBAUD_SYNC_EDGES               (5u)      /*!< Falling edges captured in the sync character */
+#define USART_AUTOBAUD_SYNC_BITS                (8u)      /*!< Bit times between the first and the last captured edge */
+/**
+ * @}
+ */
+
 /**
  * @}
  */
@@ -629,6 +731,44 @@ en_result_t USART_SetBaudrate(M0P_USART_TypeDef *USARTx,
                                     uint32_t u32Baudrate,
                                     float32_t *pf32Err);
 
+en_result_t USART_ClkSyncHandleInit(stc_clksync_handle_t *pstcHandle,
+                                    M0P_USART_TypeDef *USARTx);
+en_result_t USART_ClkSyncTransmitReceive(stc_clksync_handle_t *pstcHandle,
+                                            const uint8_t *pu8TxData,
+                                            uint8_t *pu8RxData,
+                                            uint16_t u16Size,
+                                            uint32_t u32Timeout);
+en_result_t USART_ClkSyncTransmitReceive_IT(stc_clksync_handle_t *pstcHandle,
+                                            const uint8_t *pu8TxData,
+                                            uint8_t *pu8RxData,
+                                            uint16_t u16Size);
+void USART_ClkSyncIrqHandler(stc_clksync_handle_t *pstcHandle);
+en_result_t USART_ClkSyncTransmitReceive_DMA(stc_clksync_handle_t *pstcHandle,
+                                            const uint8_t *pu8TxData,
+                                            uint8_t *pu8RxData,
+                                            uint16_t u16Size);
+void USART_ClkSyncDmaIrqHandler(stc_clksync_handle_t *pstcHandle);
+en_result_t USART_ClkSyncAbort(stc_clksync_handle_t *pstcHandle);
+en_functional_state_t USART_ClkSyncGetBusyState(const stc_clksync_handle_t *pstcHandle);
+
+en_result_t USART_SetBaudrateByBitTime(M0P_USART_TypeDef *USARTx,
+                                        uint32_t u32Ticks,
+                                        uint32_t u32Bits,
+                                        uint32_t u32TickClkDiv);
+en_result_t USART_AutoBaudHandleInit(stc_usart_autobaud_handle_t *pstcHandle,
+                                        M0P_USART_TypeDef *USARTx,
+                                        M0P_TMRB_TypeDef *TMRBx);
+en_result_t USART_AutoBaudStart(stc_usart_autobaud_handle_t *pstcHandle);
+void USART_AutoBaudIrqHandler(stc_usart_autobaud_handle_t *pstcHandle);
+en_result_t USART_AutoBaudAbort(stc_usart_autobaud_handle_t *pstcHandle);
+en_functional_state_t USART_AutoBaudGetBusyState(const stc_usart_autobaud_handle_t *pstcHandle);
+
+void USART_RxErrIrqHandler(M0P_USART_TypeDef *USARTx);
+void USART_ErrStatRingOverflow(M0P_USART_TypeDef *USARTx);
+en_result_t USART_GetErrStat(M0P_USART_TypeDef *USARTx,
+                                stc_usart_err_stat_t *pstcStat);
+en_result_t USART_ClearErrStat(M0P_USART_TypeDef *USARTx);
+
 /**
  * @}
  */
@@ -107,6 +107,12 @@ uint32_t SysTick_GetTick(void);
 void SysTick_Suspend(void);
 void SysTick_Resume(void);
 
+/* Systick timestamp functions */
+uint64_t SysTick_GetCycle(void);
+uint64_t SysTick_GetMicros(void);
+uint32_t SysTick_GetElapsedUs(uint64_t u64StartCycle);
+void SysTick_DelayUs(uint32_t u32Us);
+
 /* You can add your own assert functions by implement the function DDL_AssertHandler
    definition follow the function DDL_AssertHandler declaration */
 #ifdef __DEBUG
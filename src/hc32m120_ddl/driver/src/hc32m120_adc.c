@@ -58,6 +58,8 @@
  ******************************************************************************/
 #include "hc32m120_adc.h"
 #include "hc32m120_utility.h"
+#include "hc32m120_dma.h"
+#include "hc32m120_timer4.h"
 
 /**
  * @addtogroup HC32M120_DDL_Driver
@@ -75,6 +77,63 @@
 /*******************************************************************************
  * Local type definitions ('typedef')
  ******************************************************************************/
+/**
+ * @defgroup ADC_Local_Types ADC Local Types
+ * @{
+ */
+
+#if (DDL_DMA_ENABLE == DDL_ON)
+/**
+ * @brief ADC stream context.
+ */
+typedef struct
+{
+    stc_dma_llp_descriptor_t astcDesc[2u];  /*!< Ring half descriptors, linked to each other. */
+    uint16_t *pu16Ring;                     /*!< Ring buffer written by DMA. */
+    uint16_t *pu16Demux;                    /*!< Demultiplexed block buffer. */
+    func_ptr_adc_stream_t pfnBlock;         /*!< Block callback. */
+    uint16_t u16Scans;                      /*!< Scans per block(ring half). */
+    uint8_t  au8Offset[ADC_CH_COUNT];       /*!< Offset of each channel in one scan. */
+    uint8_t  u8ChNum;                       /*!< Number of channels. */
+    uint8_t  u8Span;                        /*!< Data registers moved per scan. */
+    uint8_t  u8DmaCh;                       /*!< DMA channel. */
+    uint8_t  u8Half;                        /*!< Ring half completed next. */
+    uint8_t  u8Run;                         /*!< 1: the stream is running. */
+} stc_adc_stream_ctx_t;
+#endif /* DDL_DMA_ENABLE */
+
+#if (DDL_TIMER4_ENABLE == DDL_ON)
+/**
+ * @brief ADC injected sampling context.
+ */
+typedef struct
+{
+    __IO uint16_t *apu16Dr[ADC_CH_COUNT];   /*!< Data registers of the channels of sequence B. */
+    stc_adc_inj_result_t *pstcResult;       /*!< Result written in the EOCB interrupt. */
+    func_ptr_adc_inj_t pfnCplt;             /*!< Completion callback. */
+    uint32_t u32SevtCh;                     /*!< Timer4 special event channel. */
+    uint16_t u16Cr0Ms;                      /*!< CR0.MS_1 before the start, restored by the stop. */
+    uint8_t  u8ChNum;                       /*!< Number of channels. */
+    uint8_t  u8Run;                         /*!< 1: the injected sampling is running. */
+} stc_adc_inj_ctx_t;
+#endif /* DDL_TIMER4_ENABLE */
+
+/**
+ * @brief ADC AWD monitor context.
+ */
+typedef struct
+{
+    stc_adc_awd_stat_t *pstcStat;           /*!< Statistics updated in the AWD interrupt. */
+    func_ptr_adc_awd_t pfnEvent;            /*!< Event callback. */
+    uint8_t au8Pin[2u];                     /*!< ADC pins of AWD0 and AWD1. */
+    uint8_t u8AwdEn;                        /*!< Enabled AWDs. */
+    uint8_t u8Wake;                         /*!< Flags that call the event callback. */
+    uint8_t u8Run;                          /*!< 1: the monitor is running. */
+} stc_adc_awd_ctx_t;
+
+/**
+ * @}
+ */
 
 /*******************************************************************************
  * Local pre-processor symbols/macros ('#define')
@@ -90,6 +149,24 @@
 #define ADC_TRG_EVT0_REG                    (M0P_AOS->ADC_ITRGSELR0)
 #define ADC_TRG_EVT1_REG                    (M0P_AOS->ADC_ITRGSELR1)
 
+/**
+ * @brief Definitions of ADC stream.
+ */
+#define ADC_STREAM_SCANS_MAX                (1023u)
+
+/**
+ * @brief Definitions of ADC oversampling.
+ */
+#define ADC_OVS_RATIO_MIN                   (4u)
+#define ADC_OVS_RATIO_MAX                   (256u)
+#define ADC_OVS_MA_LEN                      (4u)
+#define ADC_OVS_MA_SHIFT                    (2u)
+
+/**
+ * @brief Definitions of ADC calibration.
+ */
+#define ADC_CAL_AVG_SHIFT                   (4u)
+
 /**
  * @defgroup ADC_Check_Parameters_Validity ADC check parameters validity
  * @{
@@ -271,6 +348,33 @@
 (   ((x) == ADC_ANI0)                       ||                                 \
     (((x) >= ADC_ANI1) && ((x) <= ADC_ANI11)))
 
+#define IS_ADC_STREAM_MODE(x)                                                  \
+(   ((x) == ADC_MODE_SA_SINGLE)             ||                                 \
+    ((x) == ADC_MODE_SA_CONTINUOUS))
+
+#define IS_ADC_OVS_FILTER(x)                                                   \
+(   ((x) == ADC_OVS_FILTER_NONE)            ||                                 \
+    ((x) == ADC_OVS_FILTER_CIC)             ||                                 \
+    ((x) == ADC_OVS_FILTER_MA))
+
+#define IS_ADC_OVS_SHIFT(x)                                                    \
+(   ((x) <= 31u))
+
+#define IS_ADC_INJ_MATCH(x)                                                    \
+(   ((x) != 0u)                             &&                                 \
+    (((x) | 0x0Fu) == 0x0Fu))
+
+#define IS_ADC_INJ_SEVT_CH(x)                                                  \
+(   ((x) <= TIMER4_SEVT_WL))
+
+#define IS_ADC_CAL_VINT(x)                                                     \
+(   ((x) != 0u)                             &&                                 \
+    ((x) < 4096u))
+
+#define IS_ADC_DMA_CH(x)                                                       \
+(   ((x) == DMA_CHANNEL_0)                  ||                                 \
+    ((x) == DMA_CHANNEL_1))
+
 /**
  * @}
  */
@@ -286,10 +390,27 @@
 /*******************************************************************************
  * Local function prototypes ('static')
  ******************************************************************************/
+/**
+ * @defgroup ADC_Local_Functions ADC Local Functions
+ * @{
+ */
+static uint16_t AdcOvsOutput(stc_adc_ovs_t *pstcOvs);
+/**
+ * @}
+ */
 
 /*******************************************************************************
  * Local variable definitions ('static')
  ******************************************************************************/
+#if (DDL_DMA_ENABLE == DDL_ON)
+static stc_adc_stream_ctx_t m_stcAdcStream;
+#endif /* DDL_DMA_ENABLE */
+
+#if (DDL_TIMER4_ENABLE == DDL_ON)
+static stc_adc_inj_ctx_t m_stcAdcInj;
+#endif /* DDL_TIMER4_ENABLE */
+
+static stc_adc_awd_ctx_t m_stcAdcAwd;
 
 /*******************************************************************************
  * Function implementation - global ('extern') and local ('static')
@@ -944,6 +1065,810 @@ void ADC_OpaCmd(uint8_t u8OpaNbr, en_functional_state_t enNewState)
     }
 }
 
+#if (DDL_DMA_ENABLE == DDL_ON)
+/**
+ * @brief  Start the ADC stream. Sequence A is triggered by the specified event
+ *         and DMA moves every scan into a ring buffer of two halves. Each time
+ *         a half is filled it is demultiplexed per channel and handed to the
+ *         block callback.
+ * @param  [in]  pstcCfg            Pointer to a stc_adc_stream_cfg_t structure that
+ *                                  contains the configuration information of the stream.
+ * @retval An en_result_t enumeration value.
+ *   @arg  Ok:                      No errors occurred.
+ *   @arg  ErrorInvalidParameter:   pstcCfg == NULL, or no channel, or buffer == NULL,
+ *                                  or u16BlockScans out of range.
+ * @note  -(1) ADC must be initialized by ADC_Init() and stoped. The stream takes
+ *             over the channels and the trigger source of sequence A.
+ *        -(2) The function clocks of DMA and AOS must be enabled, DMA must be
+ *             enabled by DMA_Cmd() and ADC_StreamDmaIrqHandler() must be called
+ *             in the transfer complete IRQ callback of the channel.
+ *        -(3) One scan is one DMA block of data registers DRx(lowest channel) ~
+ *             DRy(highest channel), the registers of the channels which are not
+ *             in the sequence between them are moved as well and skipped by the
+ *             demultiplexer. The DMA channel reloads the descriptor of the other
+ *             half by itself, the CPU only runs once per block and reads every
+ *             sample once while demultiplexing.
+ *        -(4) A block must be consumed within the time to fill the other half.
+ */
+en_result_t ADC_StreamStart(const stc_adc_stream_cfg_t *pstcCfg)
+{
+    uint8_t  i;
+    uint8_t  u8Lowest = 0u;
+    uint16_t u16Ch;
+    uint32_t u32HalfSize;
+    stc_dma_ch_cfg_t stcDmaCfg;
+    stc_adc_trg_cfg_t stcTrgCfg;
+    stc_adc_stream_ctx_t *pstcCtx = &m_stcAdcStream;
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if ((pstcCfg != NULL) && ((pstcCfg->u16Channel & ADC_CH_ALL) != 0u) &&     \
+        (pstcCfg->pu16Ring != NULL) && (pstcCfg->pu16Demux != NULL) &&         \
+        (pstcCfg->u16BlockScans != 0u) && (pstcCfg->u16BlockScans <= ADC_STREAM_SCANS_MAX))
+    {
+        DDL_ASSERT(IS_ADC_STREAM_MODE(pstcCfg->u16ScanConvMode));
+        DDL_ASSERT(IS_ADC_SA_TRIGGER_EVT(pstcCfg->enTrgEvent));
+        DDL_ASSERT(IS_ADC_DMA_CH(pstcCfg->u8DmaCh));
+
+        ADC_StreamStop();
+
+        u16Ch = pstcCfg->u16Channel & ADC_CH_ALL;
+        while ((u16Ch & (uint16_t)(1ul << u8Lowest)) == 0u)
+        {
+            u8Lowest++;
+        }
+
+        pstcCtx->u8ChNum = 0u;
+        for (i = u8Lowest; i < ADC_CH_COUNT; i++)
+        {
+            if ((u16Ch & (uint16_t)(1ul << i)) != 0u)
+            {
+                pstcCtx->au8Offset[pstcCtx->u8ChNum] = (uint8_t)(i - u8Lowest);
+                pstcCtx->u8ChNum++;
+                pstcCtx->u8Span = (uint8_t)(i - u8Lowest + 1u);
+            }
+        }
+
+        pstcCtx->pu16Ring  = pstcCfg->pu16Ring;
+        pstcCtx->pu16Demux = pstcCfg->pu16Demux;
+        pstcCtx->pfnBlock  = pstcCfg->pfnBlock;
+        pstcCtx->u16Scans  = pstcCfg->u16BlockScans;
+        pstcCtx->u8DmaCh   = pstcCfg->u8DmaCh;
+        pstcCtx->u8Half    = 0u;
+
+        /* One block per scan, the source address repeats after every block. */
+        u32HalfSize = (uint32_t)pstcCtx->u16Scans * pstcCtx->u8Span;
+        stcDmaCfg.u32DataWidth   = DMA_DATAWIDTH_16BIT;
+        stcDmaCfg.u32BlockSize   = pstcCtx->u8Span;
+        stcDmaCfg.u32TransferCnt = pstcCtx->u16Scans;
+        stcDmaCfg.u32SrcAddr     = (uint32_t)(&(&M0P_ADC->DR0)[u8Lowest]);
+        stcDmaCfg.u32DesAddr     = (uint32_t)(&pstcCtx->pu16Ring[0u]);
+        stcDmaCfg.u32SrcInc      = DMA_SRCADDRINC_INC;
+        stcDmaCfg.u32DesInc      = DMA_DESADDRINC_INC;
+
+        /* The descriptors load the same settings with the other ring half. */
+        for (i = 0u; i < 2u; i++)
+        {
+            stcDmaCfg.u32DesAddr = (uint32_t)(&pstcCtx->pu16Ring[i * u32HalfSize]);
+            DMA_LlpDescInit(&pstcCtx->astcDesc[i], &stcDmaCfg, DMA_LLP_WAIT, &pstcCtx->astcDesc[i ^ 1u]);
+            pstcCtx->astcDesc[i].CHxCTL1 |= DMA_RPTNSSEL_ENABLE | DMA_RPTNSSEL_SRCRPT |   \
+                                            ((uint32_t)pstcCtx->u8Span << DMA_CH0CTL1_RPTNSCNT_POS);
+        }
+
+        stcDmaCfg.u32DesAddr = (uint32_t)(&pstcCtx->pu16Ring[0u]);
+        DMA_ChannelCfg(pstcCtx->u8DmaCh, &stcDmaCfg);
+        DMA_RepeatInit(pstcCtx->u8DmaCh, DMA_RPTNSSEL_SRCRPT, pstcCtx->u8Span);
+        DMA_LlpInit(pstcCtx->u8DmaCh, DMA_LLP_WAIT, (uint32_t)(&pstcCtx->astcDesc[1u]));
+        DMA_SetTriggerSrc(pstcCtx->u8DmaCh, EVT_ADC_EOCA);
+        DMA_ClearCplFlag(pstcCtx->u8DmaCh, DMA_FLAG_TC);
+        DMA_CplIrqCmd(pstcCtx->u8DmaCh, DMA_IRQ_TC, Enable);
+        DMA_ChannelEnable(pstcCtx->u8DmaCh);
+
+        /* Sequence A: the stream channels, started by the trigger event. */
+        MODIFY_REG16(M0P_ADC->CR0, ADC_MODE_MASK, pstcCfg->u16ScanConvMode);
+        M0P_ADC->CHSELRA0 = u16Ch;
+        stcTrgCfg.u16TrgSrc = ADC_TRGSRC_IN_EVT0;
+        stcTrgCfg.enEvent0  = pstcCfg->enTrgEvent;
+        stcTrgCfg.enEvent1  = EVT_AOS_STRG;
+        (void)ADC_ConfigTriggerSrc(ADC_SEQ_A, &stcTrgCfg);
+        ADC_ClrEocFlag(ADC_FLAG_EOCA);
+
+        pstcCtx->u8Run = 1u;
+        ADC_TriggerSrcCmd(ADC_SEQ_A, Enable);
+
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Stop the ADC stream.
+ * @param  None
+ * @retval None
+ */
+void ADC_StreamStop(void)
+{
+    stc_adc_stream_ctx_t *pstcCtx = &m_stcAdcStream;
+
+    if (pstcCtx->u8Run != 0u)
+    {
+        ADC_TriggerSrcCmd(ADC_SEQ_A, Disable);
+        ADC_Stop();
+
+        DMA_CplIrqCmd(pstcCtx->u8DmaCh, DMA_IRQ_TC, Disable);
+        DMA_ChannelDisable(pstcCtx->u8DmaCh);
+        DMA_ClearCplFlag(pstcCtx->u8DmaCh, DMA_FLAG_TC);
+
+        pstcCtx->u8Run = 0u;
+    }
+}
+
+/**
+ * @brief  ADC stream DMA transfer complete IRQ handler. Demultiplexes the
+ *         filled ring half and calls the block callback.
+ * @param  None
+ * @retval None
+ * @note   Call this function in the transfer complete IRQ callback of the
+ *         DMA channel set by ADC_StreamStart().
+ */
+void ADC_StreamDmaIrqHandler(void)
+{
+    uint8_t  i;
+    uint16_t j;
+    uint16_t u16Scans;
+    uint8_t  u8Span;
+    const uint16_t *pu16Half;
+    const uint16_t *pu16Src;
+    uint16_t *pu16Dest;
+    stc_adc_stream_ctx_t *pstcCtx = &m_stcAdcStream;
+
+    if ((pstcCtx->u8Run != 0u) && (Set == DMA_GetCplFlag(pstcCtx->u8DmaCh, DMA_FLAG_TC)))
+    {
+        DMA_ClearCplFlag(pstcCtx->u8DmaCh, DMA_FLAG_TC);
+
+        u16Scans = pstcCtx->u16Scans;
+        u8Span   = pstcCtx->u8Span;
+        pu16Half = &pstcCtx->pu16Ring[(uint32_t)pstcCtx->u8Half * u16Scans * u8Span];
+        pu16Dest = pstcCtx->pu16Demux;
+
+        for (i = 0u; i < pstcCtx->u8ChNum; i++)
+        {
+            pu16Src = &pu16Half[pstcCtx->au8Offset[i]];
+            for (j = 0u; j < u16Scans; j++)
+            {
+                *pu16Dest++ = *pu16Src;
+                pu16Src += u8Span;
+            }
+        }
+
+        pstcCtx->u8Half ^= 1u;
+
+        if (pstcCtx->pfnBlock != NULL)
+        {
+            pstcCtx->pfnBlock(pstcCtx->pu16Demux, u16Scans);
+        }
+    }
+}
+#endif /* DDL_DMA_ENABLE */
+
+#if (DDL_TIMER4_ENABLE == DDL_ON)
+/**
+ * @brief  Start the injected sampling. Sequence B is triggered by a Timer4
+ *         special event at the specified count value, the results are copied
+ *         into the result structure in the EOCB interrupt.
+ * @param  [in]  pstcCfg            Pointer to a stc_adc_inj_cfg_t structure that contains
+ *                                  the configuration information of the injected sampling.
+ * @param  [out] pstcResult         Pointer to the preallocated result structure.
+ * @param  [in]  pfnCplt            Called in the EOCB interrupt after the result is updated,
+ *                                  NULL: not used.
+ * @retval An en_result_t enumeration value.
+ *   @arg  Ok:                      No errors occurred.
+ *   @arg  ErrorInvalidParameter:   pstcCfg == NULL or pstcResult == NULL or no channel.
+ * @note  -(1) ADC must be initialized by ADC_Init() and stoped. Timer4 counter and PWM are
+ *             configured by the application. Sequence B interrupts sequence A, which
+ *             restarts as configured by u16RestrtFrom of ADC_Init().
+ *        -(2) ADC_InjIrqHandler() must be called in the EOCB IRQ callback, whose
+ *             priority should be the highest of the control loop.
+ *        -(3) The compare value is buffered and transferred at zero and peak, so
+ *             ADC_InjSetPhase() takes effect from the next PWM half period.
+ */
+en_result_t ADC_InjStart(const stc_adc_inj_cfg_t *pstcCfg,
+                         stc_adc_inj_result_t *pstcResult,
+                         func_ptr_adc_inj_t pfnCplt)
+{
+    uint8_t i;
+    uint16_t u16Ch;
+    stc_timer4_sevt_init_t stcSevtInit;
+    stc_adc_trg_cfg_t stcTrgCfg;
+    stc_adc_inj_ctx_t *pstcCtx = &m_stcAdcInj;
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if ((pstcCfg != NULL) && (pstcResult != NULL) && ((pstcCfg->u16Channel & ADC_CH_ALL) != 0u))
+    {
+        DDL_ASSERT(IS_ADC_INJ_SEVT_CH(pstcCfg->u32SevtCh));
+        DDL_ASSERT(IS_ADC_INJ_MATCH(pstcCfg->u16Match));
+
+        ADC_InjStop();
+
+        /* Data register addresses are resolved here, not in the interrupt. */
+        u16Ch = pstcCfg->u16Channel & ADC_CH_ALL;
+        pstcCtx->u8ChNum = 0u;
+        for (i = 0u; i < ADC_CH_COUNT; i++)
+        {
+            if ((u16Ch & (uint16_t)(1ul << i)) != 0u)
+            {
+                pstcCtx->apu16Dr[pstcCtx->u8ChNum] = &(&M0P_ADC->DR0)[i];
+                pstcCtx->u8ChNum++;
+            }
+        }
+        pstcCtx->pstcResult  = pstcResult;
+        pstcCtx->pfnCplt     = pfnCplt;
+        pstcCtx->u32SevtCh   = pstcCfg->u32SevtCh;
+        pstcResult->u32Count = 0u;
+
+        /* Timer4 special event, output on the event of the same channel. */
+        (void)TIMER4_SEVT_StructInit(&stcSevtInit);
+        stcSevtInit.u16SccrVal = pstcCfg->u16SccrVal;
+        stcSevtInit.u16Mode    = TIMER4_SEVT_MODE_COMPARE_TRIGGER;
+        stcSevtInit.u16TrigEvt = (uint16_t)(pstcCfg->u32SevtCh << TMR4_SCSR_EVTOS_POS);
+        stcSevtInit.u16BufMode = TIMER4_SEVT_BUF_CNT_ZERO_OR_PEAK;
+        stcSevtInit.stcTriggerCond.enUpMatchCmd   =                             \
+            ((pstcCfg->u16Match & ADC_INJ_MATCH_UP) != 0u) ? Enable : Disable;
+        stcSevtInit.stcTriggerCond.enDownMatchCmd =                             \
+            ((pstcCfg->u16Match & ADC_INJ_MATCH_DOWN) != 0u) ? Enable : Disable;
+        stcSevtInit.stcTriggerCond.enPeakMatchCmd =                             \
+            ((pstcCfg->u16Match & ADC_INJ_MATCH_PEAK) != 0u) ? Enable : Disable;
+        stcSevtInit.stcTriggerCond.enZeroMatchCmd =                             \
+            ((pstcCfg->u16Match & ADC_INJ_MATCH_ZERO) != 0u) ? Enable : Disable;
+        (void)TIMER4_SEVT_Init(pstcCfg->u32SevtCh, &stcSevtInit);
+
+        /* Sequence B: one scan per trigger event, the mode of sequence A is kept. */
+        pstcCtx->u16Cr0Ms = M0P_ADC->CR0 & ADC_CR0_MS_1;
+        M0P_ADC->CR0 |= ADC_CR0_MS_1;
+        M0P_ADC->CHSELRB0 = u16Ch;
+        stcTrgCfg.u16TrgSrc = ADC_TRGSRC_IN_EVT1;
+        stcTrgCfg.enEvent0  = EVT_AOS_STRG;
+        stcTrgCfg.enEvent1  = (en_event_src_t)((uint32_t)EVT_TMR4_SCMUH + pstcCfg->u32SevtCh);
+        (void)ADC_ConfigTriggerSrc(ADC_SEQ_B, &stcTrgCfg);
+        ADC_ClrEocFlag(ADC_FLAG_EOCB);
+        ADC_AdcIntCmd(ADC_SEQ_B, Enable);
+
+        pstcCtx->u8Run = 1u;
+        ADC_TriggerSrcCmd(ADC_SEQ_B, Enable);
+
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Stop the injected sampling.
+ * @param  None
+ * @retval None
+ * @note   The sequence mode(CR0.MS) is restored to the one before ADC_InjStart()
+ *         and the Timer4 special event channel is de-initialized. ADC must be stoped.
+ */
+void ADC_InjStop(void)
+{
+    stc_adc_inj_ctx_t *pstcCtx = &m_stcAdcInj;
+
+    if (pstcCtx->u8Run != 0u)
+    {
+        ADC_TriggerSrcCmd(ADC_SEQ_B, Disable);
+        (void)TIMER4_SEVT_DeInit(pstcCtx->u32SevtCh);
+        ADC_AdcIntCmd(ADC_SEQ_B, Disable);
+        ADC_ClrEocFlag(ADC_FLAG_EOCB);
+        M0P_ADC->CHSELRB0 = 0u;
+        MODIFY_REG16(M0P_ADC->CR0, ADC_CR0_MS_1, pstcCtx->u16Cr0Ms);
+
+        pstcCtx->u8Run = 0u;
+    }
+}
+
+/**
+ * @brief  Move the sampling point of the injected sampling.
+ * @param  [in]  u16SccrVal         Timer4 count value of the sampling point.
+ * @retval An en_result_t enumeration value.
+ *   @arg  Ok:                      No errors occurred.
+ *   @arg  ErrorNotReady:           The injected sampling is not started.
+ */
+en_result_t ADC_InjSetPhase(uint16_t u16SccrVal)
+{
+    en_result_t enRet = ErrorNotReady;
+
+    if (m_stcAdcInj.u8Run != 0u)
+    {
+        enRet = TIMER4_SEVT_SetSccrVal(m_stcAdcInj.u32SevtCh, u16SccrVal);
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  ADC injected sampling EOCB IRQ handler.
+ * @param  None
+ * @retval None
+ * @note   Call this function in the EOCB IRQ callback. The data registers are
+ *         read before anything else.
+ */
+void ADC_InjIrqHandler(void)
+{
+    uint8_t i;
+    const stc_adc_inj_ctx_t *pstcCtx = &m_stcAdcInj;
+    stc_adc_inj_result_t *pstcResult = pstcCtx->pstcResult;
+
+    if (pstcCtx->u8Run != 0u)
+    {
+        for (i = 0u; i < pstcCtx->u8ChNum; i++)
+        {
+            pstcResult->au16Data[i] = *pstcCtx->apu16Dr[i];
+        }
+        bM0P_ADC->ISCLRR_b.CLREOCBF = 1u;
+        pstcResult->u32Count++;
+
+        if (pstcCtx->pfnCplt != NULL)
+        {
+            pstcCtx->pfnCplt(pstcResult);
+        }
+    }
+}
+#endif /* DDL_TIMER4_ENABLE */
+
+/**
+ * @brief  Update the calibration from a raw value of the internal reference.
+ * @param  [out] pstcCal            Pointer to the calibration to be updated.
+ * @param  [in]  u32RefRaw          Raw value of the internal reference in Q4(16 times the
+ *                                  raw value), e.g. the sum of 16 conversions.
+ * @param  [in]  u16ZeroRaw         Raw value of 0mV, e.g. a channel tied to VSS, 0: no offset.
+ * @param  [in]  u16VintMv          Voltage of the internal reference in millivolt, 1 ~ 4095.
+ * @retval An en_result_t enumeration value.
+ *   @arg  Ok:                      No errors occurred.
+ *   @arg  ErrorInvalidParameter:   pstcCal == NULL or u32RefRaw is not above u16ZeroRaw.
+ * @note   This function can be called at runtime with the internal reference sampled
+ *         in an existing sequence, e.g. ADC_CH11 in sequence B.
+ */
+en_result_t ADC_CalUpdate(stc_adc_cal_t *pstcCal, uint32_t u32RefRaw,
+                          uint16_t u16ZeroRaw, uint16_t u16VintMv)
+{
+    uint32_t u32Zero = (uint32_t)u16ZeroRaw << ADC_CAL_AVG_SHIFT;
+    en_result_t enRet = ErrorInvalidParameter;
+
+    DDL_ASSERT(IS_ADC_CAL_VINT(u16VintMv));
+
+    if ((pstcCal != NULL) && (u32RefRaw > u32Zero))
+    {
+        /* mV per LSB in Q16, the Q4 of the reference value is cancelled here. */
+        pstcCal->u32Gain   = ((uint32_t)u16VintMv << (16u + ADC_CAL_AVG_SHIFT)) / (u32RefRaw - u32Zero);
+        pstcCal->u16Offset = u16ZeroRaw;
+        pstcCal->u16RefRaw = (uint16_t)(u32RefRaw >> ADC_CAL_AVG_SHIFT);
+
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Measure the internal reference and update the calibration.
+ * @param  [out] pstcCal            Pointer to the calibration to be updated.
+ * @param  [in]  u16ZeroRaw         Raw value of 0mV, 0: no offset.
+ * @param  [in]  u16VintMv          Voltage of the internal reference in millivolt, 1 ~ 4095.
+ * @param  [in]  u32Timeout         Timeout value(millisecond) of each conversion.
+ * @retval An en_result_t enumeration value.
+ *   @arg  Ok:                      No errors occurred.
+ *   @arg  ErrorInvalidParameter:   pstcCal == NULL or the reference is not above u16ZeroRaw.
+ *   @arg  ErrorTimeout:            ADC works timeout.
+ * @note  -(1) ADC must be initialized by ADC_Init() and stoped, sequence A must not be
+ *             triggered by hardware. The internal reference must be routed to the
+ *             power monitor by PWC_PwrMonInit() with PWC_PWRMON_VINREF.
+ *        -(2) The channels of sequence A and the extend channel source are restored
+ *             after the measurement.
+ */
+en_result_t ADC_CalMeasure(stc_adc_cal_t *pstcCal, uint16_t u16ZeroRaw,
+                           uint16_t u16VintMv, uint32_t u32Timeout)
+{
+    uint8_t  i;
+    uint8_t  u8ExCh;
+    uint16_t u16Ch;
+    uint16_t u16Val;
+    uint32_t u32Sum = 0u;
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if (pstcCal != NULL)
+    {
+        u16Ch  = M0P_ADC->CHSELRA0;
+        u8ExCh = M0P_ADC->EXCHSELR;
+        M0P_ADC->CHSELRA0 = ADC_CH11;
+        ADC_SetExChannel(ADC_EX_CH_SEL_INTERNAL);
+
+        enRet = Ok;
+        for (i = 0u; i < (1u << ADC_CAL_AVG_SHIFT); i++)
+        {
+            enRet = ADC_PollingSa(&u16Val, 1u, u32Timeout);
+            if (enRet != Ok)
+            {
+                break;
+            }
+            u32Sum += u16Val;
+        }
+
+        M0P_ADC->CHSELRA0 = u16Ch;
+        M0P_ADC->EXCHSELR = u8ExCh;
+
+        if (enRet == Ok)
+        {
+            enRet = ADC_CalUpdate(pstcCal, u32Sum, u16ZeroRaw, u16VintMv);
+        }
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Convert a block of raw values to millivolts.
+ * @param  [in]  pstcCal            Pointer to the calibration.
+ * @param  [in]  pu16Raw            Pointer to the raw values, e.g. from ADC_GetAllData().
+ * @param  [out] pu16Mv             Pointer to the millivolts, can be the same as pu16Raw.
+ * @param  [in]  u16Len             Number of values.
+ * @retval An en_result_t enumeration value.
+ *   @arg  Ok:                      No errors occurred.
+ *   @arg  ErrorInvalidParameter:   pstcCal == NULL or pu16Raw == NULL or pu16Mv == NULL.
+ * @note   Each value costs one subtraction and one 32bit multiply, no division.
+ *         Values below the offset give 0mV.
+ */
+en_result_t ADC_CalApply(const stc_adc_cal_t *pstcCal, const uint16_t *pu16Raw,
+                         uint16_t *pu16Mv, uint16_t u16Len)
+{
+    uint32_t u32Gain;
+    uint32_t u32Offset;
+    uint32_t u32Raw;
+    uint32_t u32Mv;
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if ((pstcCal != NULL) && (pu16Raw != NULL) && (pu16Mv != NULL))
+    {
+        u32Gain   = pstcCal->u32Gain;
+        u32Offset = pstcCal->u16Offset;
+
+        while (u16Len-- > 0u)
+        {
+            u32Raw = *pu16Raw++;
+            u32Raw = (u32Raw > u32Offset) ? (u32Raw - u32Offset) : 0u;
+            u32Mv  = (u32Raw * u32Gain + 0x8000ul) >> 16u;
+            *pu16Mv++ = (u32Mv > 0xFFFFul) ? 0xFFFFu : (uint16_t)u32Mv;
+        }
+
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Initialize the oversampling state of one channel.
+ * @param  [out] pstcOvs            Pointer to a stc_adc_ovs_t structure of the channel.
+ * @param  [in]  pstcCfg            Pointer to a stc_adc_ovs_cfg_t structure that contains
+ *                                  the configuration information of the oversampling.
+ * @retval An en_result_t enumeration value.
+ *   @arg  Ok:                      No errors occurred.
+ *   @arg  ErrorInvalidParameter:   pstcOvs == NULL or pstcCfg == NULL or ratio out of range.
+ */
+en_result_t ADC_OvsInit(stc_adc_ovs_t *pstcOvs, const stc_adc_ovs_cfg_t *pstcCfg)
+{
+    uint8_t i;
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if ((pstcOvs != NULL) && (pstcCfg != NULL) &&                              \
+        (pstcCfg->u16Ratio >= ADC_OVS_RATIO_MIN) && (pstcCfg->u16Ratio <= ADC_OVS_RATIO_MAX))
+    {
+        DDL_ASSERT(IS_ADC_OVS_FILTER(pstcCfg->u8Filter));
+        DDL_ASSERT(IS_ADC_OVS_SHIFT(pstcCfg->u8Shift));
+
+        pstcOvs->u32Acc   = 0u;
+        pstcOvs->u32Int2  = 0u;
+        pstcOvs->u32Comb1 = 0u;
+        pstcOvs->u32Comb2 = 0u;
+        pstcOvs->u32MaSum = 0u;
+        for (i = 0u; i < ADC_OVS_MA_LEN; i++)
+        {
+            pstcOvs->au32Ma[i] = 0u;
+        }
+        pstcOvs->u16Ratio = pstcCfg->u16Ratio;
+        pstcOvs->u16Cnt   = 0u;
+        pstcOvs->u8Shift  = pstcCfg->u8Shift;
+        pstcOvs->u8Filter = pstcCfg->u8Filter;
+        pstcOvs->u8MaIdx  = 0u;
+
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Oversample and decimate a block of samples of one channel.
+ * @param  [in]  pstcOvs            Pointer to a stc_adc_ovs_t structure of the channel.
+ * @param  [in]  pu16In             Pointer to the samples, such as one channel of a
+ *                                  block of ADC_StreamStart().
+ * @param  [in]  u16Len             Number of samples. It does not need to be a
+ *                                  multiple of the ratio, the remainder is kept
+ *                                  in the state for the next block.
+ * @param  [out] pu16Out            Pointer to the decimated values, at least
+ *                                  u16Len / ratio + 1 half words.
+ * @retval Number of decimated values written to pu16Out.
+ * @note   The decimated value is saturated to 0xFFFF.
+ * @note   Cycle costs on Cortex-M0+(estimated from the instruction timing):
+ *         about 7 cycles per sample with ADC_OVS_FILTER_NONE and ADC_OVS_FILTER_MA,
+ *         about 8 cycles per sample with ADC_OVS_FILTER_CIC, plus about 40 cycles
+ *         per decimated value and 30 cycles per call. At 48MHz the CPU can
+ *         decimate about 6 million samples per second, e.g. a 1024 samples
+ *         block at ratio 64 takes about 7.8k cycles(163us).
+ */
+uint16_t ADC_OvsProcess(stc_adc_ovs_t *pstcOvs, const uint16_t *pu16In,
+                        uint16_t u16Len, uint16_t *pu16Out)
+{
+    uint16_t u16Num;
+    uint16_t u16Out = 0u;
+    uint32_t u32Acc;
+    uint32_t u32Int2;
+
+    if ((pstcOvs != NULL) && (pu16In != NULL) && (pu16Out != NULL))
+    {
+        while (u16Len > 0u)
+        {
+            u16Num = pstcOvs->u16Ratio - pstcOvs->u16Cnt;
+            if (u16Num > u16Len)
+            {
+                u16Num = u16Len;
+            }
+            u16Len -= u16Num;
+            pstcOvs->u16Cnt += u16Num;
+
+            u32Acc = pstcOvs->u32Acc;
+            if (pstcOvs->u8Filter == ADC_OVS_FILTER_CIC)
+            {
+                /* Integrators run at the input rate, the wrap around is cancelled by the combs. */
+                u32Int2 = pstcOvs->u32Int2;
+                while (u16Num-- > 0u)
+                {
+                    u32Acc  += *pu16In++;
+                    u32Int2 += u32Acc;
+                }
+                pstcOvs->u32Int2 = u32Int2;
+            }
+            else
+            {
+                while (u16Num-- > 0u)
+                {
+                    u32Acc += *pu16In++;
+                }
+            }
+            pstcOvs->u32Acc = u32Acc;
+
+            if (pstcOvs->u16Cnt == pstcOvs->u16Ratio)
+            {
+                pstcOvs->u16Cnt = 0u;
+                pu16Out[u16Out] = AdcOvsOutput(pstcOvs);
+                u16Out++;
+            }
+        }
+    }
+
+    return u16Out;
+}
+
+/**
+ * @brief  Start the AWD monitor. Both AWDs, their interrupts and the
+ *         combination mode are configured from one descriptor, the AWD
+ *         interrupt keeps the statistics of the events.
+ * @param  [in]  pstcCfg            Pointer to a stc_adc_awd_monitor_cfg_t structure that contains
+ *                                  the configuration information of the monitor.
+ * @param  [out] pstcStat           Pointer to the statistics, cleared by this function.
+ * @param  [in]  pfnEvent           Called in the AWD interrupt when the wake condition
+ *                                  occurs, NULL: not used.
+ * @retval An en_result_t enumeration value.
+ *   @arg  Ok:                      No errors occurred.
+ *   @arg  ErrorInvalidParameter:  -pstcCfg == NULL or pstcStat == NULL or no AWD selected.
+ *                                 -Combination mode without both AWDs selected.
+ * @note  -(1) ADC must be stoped. The AWD channels must be in a conversion sequence.
+ *        -(2) ADC_AwdMonitorIrqHandler() must be called in the IRQ callbacks of
+ *             the enabled AWD interrupts.
+ *        -(3) Without combination mode both AWD interrupts are enabled and the
+ *             callback is called on every AWD event.
+ *        -(4) With combination mode only the AWD1 interrupt(INT_ADC_CMP1) is
+ *             enabled, it carries the combined result. Only u32CombCnt is
+ *             counted, the single AWD counts and min/max values are not
+ *             available.
+ */
+en_result_t ADC_AwdMonitorStart(const stc_adc_awd_monitor_cfg_t *pstcCfg,
+                                stc_adc_awd_stat_t *pstcStat,
+                                func_ptr_adc_awd_t pfnEvent)
+{
+    uint8_t i;
+    stc_adc_awd_ctx_t *pstcCtx = &m_stcAdcAwd;
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if ((pstcCfg != NULL) && (pstcStat != NULL) &&                             \
+        ((pstcCfg->u8AwdEn & (ADC_FLAG_AWD0 | ADC_FLAG_AWD1)) != 0u) &&          \
+        ((pstcCfg->u16CombMode == ADC_AWD_COMB_INVALID) ||                       \
+         ((pstcCfg->u8AwdEn & (ADC_FLAG_AWD0 | ADC_FLAG_AWD1)) == (ADC_FLAG_AWD0 | ADC_FLAG_AWD1))))
+    {
+        DDL_ASSERT(IS_AWD_COMB_MODE(pstcCfg->u16CombMode));
+
+        ADC_AwdMonitorStop();
+
+        for (i = 0u; i < 2u; i++)
+        {
+            pstcStat->au32Cnt[i] = 0u;
+            pstcStat->au16Min[i] = 0xFFFFu;
+            pstcStat->au16Max[i] = 0u;
+            pstcCtx->au8Pin[i]   = pstcCfg->astcAwd[i].u8AdcPin;
+        }
+        pstcStat->u32CombCnt = 0u;
+        pstcCtx->pstcStat    = pstcStat;
+        pstcCtx->pfnEvent    = pfnEvent;
+        pstcCtx->u8AwdEn     = pstcCfg->u8AwdEn & (ADC_FLAG_AWD0 | ADC_FLAG_AWD1);
+        pstcCtx->u8Wake      = (pstcCfg->u16CombMode == ADC_AWD_COMB_INVALID) ? \
+                               pstcCtx->u8AwdEn : ADC_FLAG_AWD_COMB;
+
+        for (i = 0u; i < 2u; i++)
+        {
+            if ((pstcCtx->u8AwdEn & (uint8_t)(1u << i)) != 0u)
+            {
+                (void)ADC_AwdConfig(i, &pstcCfg->astcAwd[i]);
+            }
+        }
+        ADC_AwdConfigCombMode(pstcCfg->u16CombMode);
+        ADC_AwdClrFlag(ADC_FLAG_AWD_ALL);
+
+        pstcCtx->u8Run = 1u;
+        for (i = 0u; i < 2u; i++)
+        {
+            if ((pstcCtx->u8AwdEn & (uint8_t)(1u << i)) != 0u)
+            {
+                /* The combined result is signalled by the AWD1 interrupt. */
+                if ((pstcCtx->u8Wake != ADC_FLAG_AWD_COMB) || (i == ADC_AWD_1))
+                {
+                    ADC_AwdIntCmd(i, Enable);
+                }
+                ADC_AwdCmd(i, Enable);
+            }
+        }
+
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Stop the AWD monitor.
+ * @param  None
+ * @retval None
+ * @note   ADC must be stoped.
+ */
+void ADC_AwdMonitorStop(void)
+{
+    uint8_t i;
+    stc_adc_awd_ctx_t *pstcCtx = &m_stcAdcAwd;
+
+    if (pstcCtx->u8Run != 0u)
+    {
+        for (i = 0u; i < 2u; i++)
+        {
+            ADC_AwdCmd(i, Disable);
+            ADC_AwdIntCmd(i, Disable);
+        }
+        ADC_AwdConfigCombMode(ADC_AWD_COMB_INVALID);
+        ADC_AwdClrFlag(ADC_FLAG_AWD_ALL);
+
+        pstcCtx->u8Run = 0u;
+    }
+}
+
+/**
+ * @brief  ADC AWD monitor IRQ handler. Counts the events and updates the
+ *         minimum and maximum of the values that raised them.
+ * @param  None
+ * @retval None
+ * @note   Call this function in the IRQ callbacks of the AWD interrupts enabled
+ *         by ADC_AwdMonitorStart().
+ */
+void ADC_AwdMonitorIrqHandler(void)
+{
+    uint8_t i;
+    uint8_t u8Flag;
+    uint16_t u16Val;
+    stc_adc_awd_ctx_t *pstcCtx = &m_stcAdcAwd;
+    stc_adc_awd_stat_t *pstcStat = pstcCtx->pstcStat;
+
+    if (pstcCtx->u8Run != 0u)
+    {
+        u8Flag = M0P_ADC->AWDSR & ADC_FLAG_AWD_ALL;
+        ADC_AwdClrFlag(u8Flag);
+
+        for (i = 0u; i < 2u; i++)
+        {
+            /* Single AWD flags are not sampled per event in combination mode. */
+            if (((u8Flag & (uint8_t)(1u << i)) != 0u) && (pstcCtx->u8Wake != ADC_FLAG_AWD_COMB))
+            {
+                u16Val = ADC_GetValue(pstcCtx->au8Pin[i]);
+                pstcStat->au32Cnt[i]++;
+                if (u16Val < pstcStat->au16Min[i])
+                {
+                    pstcStat->au16Min[i] = u16Val;
+                }
+                if (u16Val > pstcStat->au16Max[i])
+                {
+                    pstcStat->au16Max[i] = u16Val;
+                }
+            }
+        }
+
+        if ((u8Flag & ADC_FLAG_AWD_COMB) != 0u)
+        {
+            pstcStat->u32CombCnt++;
+        }
+
+        if ((pstcCtx->pfnEvent != NULL) && ((u8Flag & pstcCtx->u8Wake) != 0u))
+        {
+            pstcCtx->pfnEvent(u8Flag, pstcStat);
+        }
+    }
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @addtogroup ADC_Local_Functions ADC Local Functions
+ * @{
+ */
+
+/**
+ * @brief  Compute one decimated value at the end of a ratio period.
+ * @param  [in]  pstcOvs            Pointer to a stc_adc_ovs_t structure of the channel.
+ * @retval The decimated value.
+ */
+static uint16_t AdcOvsOutput(stc_adc_ovs_t *pstcOvs)
+{
+    uint32_t u32Val;
+    uint32_t u32Comb;
+
+    if (pstcOvs->u8Filter == ADC_OVS_FILTER_CIC)
+    {
+        /* Combs run at the output rate with differential delay 1. */
+        u32Comb = pstcOvs->u32Int2 - pstcOvs->u32Comb1;
+        pstcOvs->u32Comb1 = pstcOvs->u32Int2;
+        u32Val  = u32Comb - pstcOvs->u32Comb2;
+        pstcOvs->u32Comb2 = u32Comb;
+    }
+    else
+    {
+        u32Val = pstcOvs->u32Acc;
+        pstcOvs->u32Acc = 0u;
+    }
+
+    u32Val >>= pstcOvs->u8Shift;
+
+    if (pstcOvs->u8Filter == ADC_OVS_FILTER_MA)
+    {
+        pstcOvs->u32MaSum += u32Val - pstcOvs->au32Ma[pstcOvs->u8MaIdx];
+        pstcOvs->au32Ma[pstcOvs->u8MaIdx] = u32Val;
+        pstcOvs->u8MaIdx = (pstcOvs->u8MaIdx + 1u) & (ADC_OVS_MA_LEN - 1u);
+        u32Val = pstcOvs->u32MaSum >> ADC_OVS_MA_SHIFT;
+    }
+
+    if (u32Val > 0xFFFFul)
+    {
+        u32Val = 0xFFFFul;
+    }
+
+    return (uint16_t)u32Val;
+}
+
 /**
  * @}
  */
@@ -225,6 +225,22 @@ void DMA_ChannelDisable(uint8_t u8Ch)
     M0P_DMA->CHENCLR = 1ul << u8Ch;
 }
 
+/**
+ * @brief  Get the enable state of the specified DAM channel.
+ * @param  u8Ch                 The specified DMA channel.
+ *           @arg  This parameter can be: DMA_CHANNEL_0 or DMA_CHANNEL_1.
+ * @retval An en_functional_state_t enumeration value:
+ *           - Enable: The channel is enabled
+ *           - Disable: The channel is disabled, by DMA_ChannelDisable() or
+ *             by the hardware at the end of the transfer
+ */
+en_functional_state_t DMA_GetChannelState(uint8_t u8Ch)
+{
+    DDL_ASSERT(IS_VALID_DMA_CH(u8Ch));
+
+    return ((0ul == (M0P_DMA->CHEN & (1ul << u8Ch))) ? Disable : Enable);
+}
+
 /**
  * @brief  Enable or disable the specified DMA error interrupt.
  * @param  u8Ch                 The specified DMA channel.
@@ -387,6 +403,100 @@ void DMA_LlpInit(uint8_t u8Ch, uint32_t u32LlpRun, uint32_t u32Llp)
                ((u32Llp & DMA_LLP_MASK) << (DMA_CH0CTL0_LLP_POS - 2ul)));
 }
 
+/**
+ * @brief  Enable or disable the DMA LLP(link listed pointer) transfer.
+ * @param  u8Ch                 The specified DMA channel.
+ *           @arg  This parameter can be: DMA_CHANNEL_0 or DMA_CHANNEL_1.
+ * @param  enNewState           The function new state.
+ *           @arg  This parameter can be: Enable or Disable.
+ * @retval None
+ * @note   The llp mode & next descriptor address set by DMA_LlpInit() are
+ *         kept.
+ */
+void DMA_LlpCmd(uint8_t u8Ch, en_functional_state_t enNewState)
+{
+    DDL_ASSERT(IS_VALID_DMA_CH(u8Ch));
+    DDL_ASSERT(IS_FUNCTIONAL_STATE(enNewState));
+
+    if (Enable == enNewState)
+    {
+        SET_REG32_BIT(DMA_CH_REG(M0P_DMA->CH0CTL0, u8Ch), DMA_LLP_ENABLE);
+    }
+    else
+    {
+        CLEAR_REG32_BIT(DMA_CH_REG(M0P_DMA->CH0CTL0, u8Ch), DMA_LLP_ENABLE);
+    }
+}
+
+/**
+ * @brief  Enable or disable the DMA repeat or non_sequence transfer.
+ * @param  u8Ch                 The specified DMA channel.
+ *           @arg  This parameter can be: DMA_CHANNEL_0 or DMA_CHANNEL_1.
+ * @param  enNewState           The function new state.
+ *           @arg  This parameter can be: Enable or Disable.
+ * @retval None
+ * @note   The selection, count & offset set by DMA_RepeatInit() or
+ *         DMA_NonSeqInit() are kept.
+ */
+void DMA_RptNSeqCmd(uint8_t u8Ch, en_functional_state_t enNewState)
+{
+    DDL_ASSERT(IS_VALID_DMA_CH(u8Ch));
+    DDL_ASSERT(IS_FUNCTIONAL_STATE(enNewState));
+
+    if (Enable == enNewState)
+    {
+        SET_REG32_BIT(DMA_CH_REG(M0P_DMA->CH0CTL1, u8Ch), DMA_RPTNSSEL_ENABLE);
+    }
+    else
+    {
+        CLEAR_REG32_BIT(DMA_CH_REG(M0P_DMA->CH0CTL1, u8Ch), DMA_RPTNSSEL_ENABLE);
+    }
+}
+
+/**
+ * @brief  Initialize a DMA LLP(link listed pointer) descriptor in memory.
+ * @param  pstcDesc              The descriptor to be initialized.
+ * @param  pstcChCfg             The configuration loaded by the descriptor,
+ *                               see DMA_ChannelCfg().
+ * @param  u32LlpRun             The llp mode towards the next descriptor.
+ *           @arg DMA_LLP_RUN
+ *           @arg DMA_LLP_WAIT
+ * @param  pstcNext              The next descriptor, NULL ends the chain.
+ * @retval None
+ * @note   Repeat and non_sequence transfer are disabled in the descriptor,
+ *         set the DMA_Rpt_Nonseq_State & DMA_Rpt_Nonseq_Sel bits of CHxCTL1
+ *         afterwards if required.
+ * @note   The descriptors must be located in the SRAM, only the address bits
+ *         [11:2] are held by the LLP field.
+ */
+void DMA_LlpDescInit(stc_dma_llp_descriptor_t *pstcDesc,
+                     const stc_dma_ch_cfg_t *pstcChCfg,
+                     uint32_t u32LlpRun,
+                     const stc_dma_llp_descriptor_t *pstcNext)
+{
+    uint32_t u32Llp = DMA_LLP_DISABLE;
+
+    DDL_ASSERT(NULL != pstcDesc);
+    DDL_ASSERT(NULL != pstcChCfg);
+    DDL_ASSERT(IS_VALID_DMA_TRN_WIDTH(pstcChCfg->u32DataWidth));
+    DDL_ASSERT(IS_VALID_DMA_SADDR_MODE(pstcChCfg->u32SrcInc));
+    DDL_ASSERT(IS_VALID_DMA_DADDR_MODE(pstcChCfg->u32DesInc));
+    DDL_ASSERT(IS_VALID_DMA_LLP_MODE(u32LlpRun));
+
+    if (NULL != pstcNext)
+    {
+        u32Llp = DMA_LLP_ENABLE | u32LlpRun |
+                 (((uint32_t)pstcNext & DMA_LLP_MASK) << (DMA_CH0CTL0_LLP_POS - 2ul));
+    }
+
+    pstcDesc->SARx    = pstcChCfg->u32SrcAddr;
+    pstcDesc->DARx    = pstcChCfg->u32DesAddr;
+    pstcDesc->CHxCTL0 = pstcChCfg->u32BlockSize |
+                        (pstcChCfg->u32TransferCnt << DMA_CH0CTL0_CNT_POS) |
+                        pstcChCfg->u32DataWidth | u32Llp;
+    pstcDesc->CHxCTL1 = pstcChCfg->u32SrcInc | pstcChCfg->u32DesInc;
+}
+
 /**
  * @brief  Set the source address of the specified ADM channel.
  * @param  u8Ch                 The specified DMA channel.
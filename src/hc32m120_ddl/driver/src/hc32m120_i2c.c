@@ -57,6 +57,8 @@
  * Include files
  ******************************************************************************/
 #include "hc32m120_i2c.h"
+#include "hc32m120_dma.h"
+#include "hc32m120_gpio.h"
 #include "hc32m120_utility.h"
 
 /**
@@ -75,6 +77,66 @@
 /*******************************************************************************
  * Local type definitions ('typedef')
  ******************************************************************************/
+/**
+ * @defgroup I2C_Local_Types I2C Local Types
+ * @{
+ */
+
+/**
+ * @brief I2C master transaction engine context
+ */
+typedef struct
+{
+    stc_i2c_master_xfer_t   stcXfer;        /*!< Ongoing transaction */
+    func_ptr_i2c_cplt_t     pfnCplt;        /*!< Transaction complete callback */
+    uint16_t                u16TxIdx;       /*!< Index of the next byte to be sent */
+    uint16_t                u16RxIdx;       /*!< Index of the next byte to be received */
+    __IO uint32_t           u32TimeoutCnt;  /*!< Remaining time of the transaction in ticks, 0: no timeout */
+    __IO uint8_t            u8State;        /*!< Engine state */
+    __IO en_result_t        enResult;       /*!< Result of the transaction */
+    stc_i2c_job_t           *pstcJob;       /*!< Current job of the queue, NULL for single transaction */
+    uint16_t                u16JobRemain;   /*!< Count of jobs not completed, including the current one */
+    en_result_t             enBatchResult;  /*!< Result of the jobs completed */
+    uint8_t                 u8Reg;          /*!< Register address sent before the write phase */
+    uint8_t                 u8RegLen;       /*!< 1: send u8Reg before the write phase, 0: not */
+    uint8_t                 u8DmaEn;        /*!< 1: move the data phase by DMA, 0: by CPU */
+    uint8_t                 u8DmaCh;        /*!< DMA channel of the data phase */
+    uint8_t                 u8PecEn;        /*!< 1: SMBus PEC follows the last byte, 0: not */
+    uint8_t                 u8Pec;          /*!< CRC-8 of the bytes moved so far */
+    uint8_t                 u8BlockRd;      /*!< 1: the first byte read is the SMBus block count, 0: not */
+    uint8_t                 u8SmbErr;       /*!< 1: PEC mismatch or invalid block count, 0: not */
+    uint8_t                 u8FastAck;      /*!< FACKEN of CR1 saved while the SMBus block count is read */
+}stc_i2c_master_ctx_t;
+
+/**
+ * @brief I2C slave register map engine context
+ */
+typedef struct
+{
+    stc_i2c_slave_regmap_t  astcMap[2]; /*!< Register maps of SLADDR0 and SLADDR1 */
+    uint16_t                au16Ptr[2]; /*!< Register pointers of SLADDR0 and SLADDR1 */
+    stc_i2c_slave_regmap_t  *pstcMap;   /*!< Register map of the addressed slave, NULL: not addressed */
+    uint16_t                *pu16Ptr;   /*!< Register pointer of the addressed slave */
+    uint16_t                u16WrCnt;   /*!< Registers written in the ongoing write phase */
+    uint8_t                 u8WrReg;    /*!< First register of the ongoing write phase */
+    uint8_t                 u8PtrSet;   /*!< 1: register pointer is received in the write phase, 0: not */
+}stc_i2c_slave_ctx_t;
+
+/**
+ * @brief I2C SMBus layer context
+ */
+typedef struct
+{
+    uint8_t                 au8Tx[2u + I2C_SMBUS_BLOCK_MAX];    /*!< Command, byte count and data of the write phase */
+    uint8_t                 u8PecEn;        /*!< 1: PEC is used by the SMBus transactions, 0: not */
+    uint8_t                 u8AlertAdr;     /*!< Own address sent in the alert response */
+    __IO uint8_t            u8AlertState;   /*!< Alert response state */
+    func_ptr_i2c_cplt_t     pfnAlertCplt;   /*!< Alert response complete callback */
+}stc_i2c_smbus_ctx_t;
+
+/**
+ * @}
+ */
 
 /*******************************************************************************
  * Local pre-processor symbols/macros ('#define')
@@ -86,8 +148,57 @@
 
 #define I2C_BAUDRATE_MAX                400000ul
 
+/* Integer baudrate solver */
+#define I2C_SCL_WIDTH_MAX               (0x1Ful)    /*!< Max value of CCR.SLOWW and CCR.SHIGHW */
+#define I2C_BAUDRATE_STD_MAX            (100000ul)  /*!< Above: fast mode, SCL low level is longer */
+#define I2C_CLK_DIV_MAX                 (I2C_CLK_DIV128)
+
 #define I2C_CLR_MASK                   ((uint32_t)0x00F012DF)
 
+/* I2C master engine state */
+#define I2C_MASTER_STATE_IDLE           (0u)
+#define I2C_MASTER_STATE_START          (1u)    /*!< Wait start condition, then send address with write */
+#define I2C_MASTER_STATE_TX             (2u)    /*!< Write phase */
+#define I2C_MASTER_STATE_RESTART        (3u)    /*!< Wait start condition, then send address with read */
+#define I2C_MASTER_STATE_RX             (4u)    /*!< Read phase */
+#define I2C_MASTER_STATE_STOP           (5u)    /*!< Wait stop condition */
+
+/* Interrupts used by the I2C master engine */
+#define I2C_MASTER_INT_MASK                                                    \
+(   I2C_CR2_STARTIE     | I2C_CR2_TENDIE    | I2C_CR2_STOPIE    |              \
+    I2C_CR2_RFULLIE     | I2C_CR2_TEMPTYIE  | I2C_CR2_ARLOIE    |              \
+    I2C_CR2_NACKIE)
+
+/* Address byte direction bit */
+#define I2C_ADR_DIR_W                   (0x00u)
+#define I2C_ADR_DIR_R                   (0x01u)
+
+/* Data phase moved by DMA: shorter phases are moved by CPU */
+#define I2C_MASTER_DMA_MIN_SIZE         (3u)
+#define I2C_MASTER_DMA_MAX_SIZE         (1023u) /*!< Max bytes of one DMA transfer (DMA_CHxCTL0.CNT) */
+
+/* Bus recovery */
+#define I2C_BUS_RECOVER_PULSES          (9u)    /*!< SCL pulses to finish the byte held by a slave */
+#define I2C_BUS_RECOVER_HALF_US         (5u)    /*!< Half SCL period of the recovery, 100kbps */
+#define I2C_BUS_STRETCH_MAX_US          (100u)  /*!< Max time of a slave stretching SCL low */
+
+/* SMBus options of the master transaction */
+#define I2C_SMBUS_OPT_PEC               (0x01u)
+#define I2C_SMBUS_OPT_BLOCK_RD          (0x02u)
+
+/* SMBus alert response state */
+#define I2C_SMBUS_ALERT_IDLE            (0u)
+#define I2C_SMBUS_ALERT_RAISED          (1u)    /*!< Wait the master reading the alert response address */
+#define I2C_SMBUS_ALERT_RESPOND         (2u)    /*!< Own address is sent, wait NACK or stop */
+
+/* Max number of registers of the slave register map */
+#define I2C_SLAVE_REG_NUM_MAX           (256u)
+
+/* Interrupts used by the I2C slave engine during the transaction */
+#define I2C_SLAVE_XFER_INT_MASK                                                \
+(   I2C_CR2_TEMPTYIE    | I2C_CR2_RFULLIE   | I2C_CR2_STOPIE    |              \
+    I2C_CR2_NACKIE)
+
 /**
  * @defgroup I2C_Check_Parameters_Validity I2C Check Parameters Validity
  * @{
@@ -129,6 +240,10 @@
 #define IS_VALID_7BIT_ADR(x)           ((x) <= 0x7Fu)
 #define IS_VALIDE_10BIT_ADR(x)          ((x) <= 0x3FFu)
 
+#define IS_VALID_JOB_DIR(x)                                                    \
+(   ((x) == I2C_JOB_DIR_WRITE)                     ||                          \
+    ((x) == I2C_JOB_DIR_READ))
+
 #define IS_VALID_ADR_NUM(x)                                                    \
 (   ((x) == I2C_ADR_0)                             ||                          \
     ((x) == I2C_ADR_1))
@@ -158,10 +273,59 @@
 /*******************************************************************************
  * Local function prototypes ('static')
  ******************************************************************************/
+/**
+ * @defgroup I2C_Local_Functions I2C Local Functions
+ * @{
+ */
+static void I2cMasterSendAdr(void);
+static void I2cMasterTxProcess(uint32_t u32Status);
+static void I2cMasterRxProcess(uint32_t u32Status);
+static void I2cMasterKick(void);
+static void I2cMasterXferDone(void);
+static void I2cMasterStop(en_result_t enResult);
+static void I2cMasterFinish(en_result_t enResult);
+static void I2cMasterLoadJob(void);
+static void I2cMasterJobDone(en_result_t enResult);
+static uint16_t I2cMasterDmaSize(uint32_t u32Len);
+static void I2cMasterDmaStart(uint8_t u8Dir, uint16_t u16Size);
+static void I2cMasterDmaStop(void);
+static void I2cSlaveWriteDone(void);
+static uint8_t I2cSlaveReadNext(void);
+static en_result_t I2cMasterXferStart(const stc_i2c_master_xfer_t *pstcXfer,
+                                      uint32_t u32Timeout,
+                                      func_ptr_i2c_cplt_t pfnCplt,
+                                      uint8_t u8SmbOpt);
+static uint32_t I2cMasterTxTotal(void);
+static uint32_t I2cMasterRxTotal(void);
+static uint8_t I2cSmbusCrc8(uint8_t u8Crc, uint8_t u8Data);
+static void I2cBusDelayUs(uint32_t u32Us);
+static uint32_t I2cBusUsToLoop(uint32_t u32Us);
+
+/**
+ * @}
+ */
 
 /*******************************************************************************
  * Local variable definitions ('static')
  ******************************************************************************/
+/**
+ * @defgroup I2C_Local_Variables I2C Local Variables
+ * @{
+ */
+static stc_i2c_master_ctx_t m_stcI2cMaster;
+static stc_i2c_slave_ctx_t m_stcI2cSlave;
+static stc_i2c_smbus_ctx_t m_stcI2cSmbus;
+
+/* CRC-8 (x^8 + x^2 + x + 1) of the high nibble, used for SMBus PEC */
+static const uint8_t m_au8SmbusCrc8Nibble[16u] =
+{
+    0x00u, 0x07u, 0x0Eu, 0x09u, 0x1Cu, 0x1Bu, 0x12u, 0x15u,
+    0x38u, 0x3Fu, 0x36u, 0x31u, 0x24u, 0x23u, 0x2Au, 0x2Du
+};
+
+/**
+ * @}
+ */
 
 /*******************************************************************************
  * Function implementation - global ('extern') and local ('static')
@@ -269,6 +433,146 @@ en_result_t I2C_BaudrateConfig(const stc_i2c_init_t* pstcI2C_InitStruct, float32
     return enRet;
 }
 
+/**
+ * @brief  Search the I2C clock division and SCL widths for the baudrate
+ *         with integer arithmetic only.
+ * @param  [in] u32Baudrate          Target baudrate, 1 ~ 400000
+ * @param  [in] u32SclTimeNs         SCL rising time + falling time in ns,
+ *                                   according to the bus capacitance and pull-up
+ * @param  [out] pstcBaud            Pointer to a @ref stc_i2c_baud_t structure
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Solved successfully
+ *           - ErrorInvalidParameter: pstcBaud == NULL, the baudrate is out
+ *                                    of range or can't be reached from the
+ *                                    current SystemCoreClock
+ * @note   SCL period in I2C clocks is SLOWW + SHIGHW + 2 * (3 or 2) + 2 * DNF
+ *         + SCL rising and falling time, 3 without clock division and 2 with
+ *         it. I2C_BaudrateConfig() always takes 2, so at I2C_CLK_DIV1 the two
+ *         functions give different SCL widths.
+ *         Every division is tried, the one with the smallest error wins and
+ *         the smaller division is kept when equal. The period is rounded up
+ *         so the actual baudrate never exceeds the target.
+ * @note   Above 100kbps the SCL low level takes 2/3 of SLOWW + SHIGHW to
+ *         meet tLOW(1.3us) > tHIGH(0.6us) of the fast mode. Solutions with
+ *         SLOWW + SHIGHW < 2 are rejected, so SHIGHW is never 0.
+ * @note   The digital filter must be configured before calling this function,
+ *         its capacity is read from the FLTR register.
+ */
+en_result_t I2C_BaudrateCalc(uint32_t u32Baudrate, uint32_t u32SclTimeNs, stc_i2c_baud_t *pstcBaud)
+{
+    uint32_t u32Div;
+    uint32_t u32Fixed;
+    uint32_t u32Total;
+    uint32_t u32Width;
+    uint32_t u32Low;
+    uint32_t u32Rate;
+    uint32_t u32Err;
+    uint32_t u32MinErr = 0xFFFFFFFFul;
+    uint32_t u32DnfSum = 0ul;
+    uint32_t u32HclkMhz = (SystemCoreClock + 999999ul) / 1000000ul;
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if ((NULL != pstcBaud) && (0ul != u32Baudrate) && IS_VALID_SPEED(u32Baudrate))
+    {
+        if (0u != READ_REG32_BIT(M0P_I2C->FLTR, I2C_FLTR_DNFEN))
+        {
+            u32DnfSum = ((M0P_I2C->FLTR & I2C_FLTR_DNF) >> I2C_FLTR_DNF_POS) + 1ul;
+        }
+
+        for (u32Div = I2C_CLK_DIV1; u32Div <= I2C_CLK_DIV_MAX; u32Div++)
+        {
+            /* Fixed part of the period: clock divider, filter and SCL edges rounded up */
+            u32Fixed = ((I2C_CLK_DIV1 == u32Div) ? 6ul : 4ul) + (2ul * u32DnfSum)          \
+                       + (((u32SclTimeNs * u32HclkMhz) + (1000ul << u32Div) - 1ul) / (1000ul << u32Div));
+
+            /* Period in I2C clocks rounded up: baudrate not higher than the target */
+            u32Total = (SystemCoreClock + (u32Baudrate << u32Div) - 1ul) / (u32Baudrate << u32Div);
+
+            /* Both SLOWW and SHIGHW need at least 1 clock */
+            if ((u32Total >= (u32Fixed + 2ul)) && ((u32Total - u32Fixed) <= (2ul * I2C_SCL_WIDTH_MAX)))
+            {
+                u32Rate = (SystemCoreClock >> u32Div) / u32Total;
+                u32Err = u32Baudrate - u32Rate;
+                if (u32Err < u32MinErr)
+                {
+                    u32MinErr = u32Err;
+                    u32Width = u32Total - u32Fixed;
+
+                    if (u32Baudrate > I2C_BAUDRATE_STD_MAX)
+                    {
+                        u32Low = ((2ul * u32Width) + 2ul) / 3ul;
+                    }
+                    else
+                    {
+                        u32Low = u32Width - (u32Width / 2ul);
+                    }
+                    if (u32Low > I2C_SCL_WIDTH_MAX)
+                    {
+                        u32Low = I2C_SCL_WIDTH_MAX;
+                    }
+                    if (u32Low >= u32Width)
+                    {
+                        u32Low = u32Width - 1ul;
+                    }
+
+                    pstcBaud->u32I2cClkDiv = u32Div;
+                    pstcBaud->u32SclLowW = u32Low;
+                    pstcBaud->u32SclHighW = u32Width - u32Low;
+                    pstcBaud->u32Baudrate = u32Rate;
+                    enRet = Ok;
+                }
+            }
+        }
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Initialize the I2C baudrate by I2C_BaudrateCalc(), without
+ *         floating point arithmetic.
+ * @param  [in] u32Baudrate          Target baudrate, 1 ~ 400000
+ * @param  [in] u32SclTimeNs         SCL rising time + falling time in ns
+ * @param  [out] pstcBaud            Pointer to a @ref stc_i2c_baud_t structure
+ *                                   to get the solved result, NULL: not needed
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Initialized successfully
+ *           - ErrorInvalidParameter: The baudrate can't be solved, the
+ *                                    CCR register is not changed
+ * @note   It can be used in place of I2C_Init(), the general call setting
+ *         is not changed and the I2C peripheral is disabled when returns.
+ */
+en_result_t I2C_BaudrateAutoConfig(uint32_t u32Baudrate, uint32_t u32SclTimeNs, stc_i2c_baud_t *pstcBaud)
+{
+    stc_i2c_baud_t stcBaud;
+    en_result_t enRet;
+
+    /* Register and internal status reset */
+    bM0P_I2C->CR1_b.PE = 0u;
+    bM0P_I2C->CR1_b.SWRST = 1u;
+    bM0P_I2C->CR1_b.PE = 1u;
+
+    enRet = I2C_BaudrateCalc(u32Baudrate, u32SclTimeNs, &stcBaud);
+    if (Ok == enRet)
+    {
+        M0P_I2C->CCR = (stcBaud.u32I2cClkDiv << I2C_CCR_CKDIV_POS)                  \
+                       | (stcBaud.u32SclLowW << I2C_CCR_SLOWW_POS)                  \
+                       | (stcBaud.u32SclHighW << I2C_CCR_SHIGHW_POS);
+
+        if (NULL != pstcBaud)
+        {
+            *pstcBaud = stcBaud;
+        }
+    }
+
+    /* Release software reset */
+    bM0P_I2C->CR1_b.SWRST = 0u;
+    /* Disable I2C peripheral */
+    bM0P_I2C->CR1_b.PE = 0u;
+
+    return enRet;
+}
+
 /**
  * @brief  De-initialize I2C unit
  *
@@ -281,6 +585,120 @@ void I2C_DeInit(void)
     bM0P_I2C->CR1_b.SWRST = 1u;
 }
 
+/**
+ * @brief  Wait until the I2C bus is idle, with a bounded time budget.
+ * @param  [in] u32TimeoutUs         Time budget in us, 0: check once
+ * @retval An en_result_t enumeration value:
+ *           - Ok: The bus is idle
+ *           - ErrorTimeout: The bus is still busy when the budget is used up
+ * @note   The budget is counted by CPU loops from SystemCoreClock, it is
+ *         not accurate but never waits much longer than u32TimeoutUs.
+ *         When ErrorTimeout is returned and SDA is held low by a slave,
+ *         call I2C_BusRecover().
+ */
+en_result_t I2C_WaitBusIdle(uint32_t u32TimeoutUs)
+{
+    __IO uint32_t u32Loop = I2cBusUsToLoop(u32TimeoutUs);
+    en_result_t enRet = Ok;
+
+    while (0u != READ_REG32_BIT(M0P_I2C->SR, I2C_SR_BUSY))
+    {
+        if (0ul == u32Loop)
+        {
+            enRet = ErrorTimeout;
+            break;
+        }
+        u32Loop--;
+    }
+
+    return enRet;
+}
+
+#if (DDL_GPIO_ENABLE == DDL_ON)
+/**
+ * @brief  Release the I2C bus held by a slave.
+ * @param  [in] pstcPin              Pointer to a @ref stc_i2c_bus_pin_t structure
+ * @retval An en_result_t enumeration value:
+ *           - Ok: SDA is released and a stop condition is generated
+ *           - Error: SDA is still held low after the recovery
+ *           - ErrorInvalidParameter: pstcPin == NULL
+ * @note   The pins are switched to open-drain GPIO, up to 9 SCL pulses are
+ *         clocked at about 100kbps until SDA is released, then a stop
+ *         condition is generated. The I2C function is restored by
+ *         GPIO_SetFunc() and the I2C internal state is reset by
+ *         I2C_SoftwareResetCmd(), the registers keep their configuration.
+ * @note   It takes about 100us for a bus stuck in the middle of a byte.
+ *         Abort the ongoing transaction by I2C_MasterAbort() before.
+ */
+en_result_t I2C_BusRecover(const stc_i2c_bus_pin_t *pstcPin)
+{
+    stc_gpio_init_t stcGpioInit;
+    uint32_t i;
+    uint32_t u32Stretch;
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if (NULL != pstcPin)
+    {
+        (void)GPIO_StructInit(&stcGpioInit);
+        stcGpioInit.u16PinMode = PIN_MODE_OUT;
+        stcGpioInit.u16PinOType = PIN_OTYPE_NMOS;
+        stcGpioInit.u16PinState = PIN_STATE_SET;
+        (void)GPIO_Init(pstcPin->u8SclPort, pstcPin->u8SclPin, &stcGpioInit);
+        (void)GPIO_Init(pstcPin->u8SdaPort, pstcPin->u8SdaPin, &stcGpioInit);
+        GPIO_SetFunc(pstcPin->u8SclPort, pstcPin->u8SclPin, GPIO_FUNC_0_GPO);
+        GPIO_SetFunc(pstcPin->u8SdaPort, pstcPin->u8SdaPin, GPIO_FUNC_0_GPO);
+        I2cBusDelayUs(I2C_BUS_RECOVER_HALF_US);
+
+        /* Clock out the byte the slave is sending until it releases SDA */
+        for (i = 0ul; i < I2C_BUS_RECOVER_PULSES; i++)
+        {
+            if (Pin_Set == GPIO_ReadInputPortPin(pstcPin->u8SdaPort, pstcPin->u8SdaPin))
+            {
+                break;
+            }
+            GPIO_ResetPins(pstcPin->u8SclPort, pstcPin->u8SclPin);
+            I2cBusDelayUs(I2C_BUS_RECOVER_HALF_US);
+            GPIO_SetPins(pstcPin->u8SclPort, pstcPin->u8SclPin);
+
+            /* The slave may stretch SCL */
+            u32Stretch = I2C_BUS_STRETCH_MAX_US / I2C_BUS_RECOVER_HALF_US;
+            do
+            {
+                I2cBusDelayUs(I2C_BUS_RECOVER_HALF_US);
+            } while ((Pin_Reset == GPIO_ReadInputPortPin(pstcPin->u8SclPort, pstcPin->u8SclPin)) &&
+                     (0ul != u32Stretch--));
+        }
+
+        /* Stop condition: SDA rises while SCL is high */
+        GPIO_ResetPins(pstcPin->u8SclPort, pstcPin->u8SclPin);
+        I2cBusDelayUs(I2C_BUS_RECOVER_HALF_US);
+        GPIO_ResetPins(pstcPin->u8SdaPort, pstcPin->u8SdaPin);
+        I2cBusDelayUs(I2C_BUS_RECOVER_HALF_US);
+        GPIO_SetPins(pstcPin->u8SclPort, pstcPin->u8SclPin);
+        I2cBusDelayUs(I2C_BUS_RECOVER_HALF_US);
+        GPIO_SetPins(pstcPin->u8SdaPort, pstcPin->u8SdaPin);
+        I2cBusDelayUs(I2C_BUS_RECOVER_HALF_US);
+
+        if (Pin_Set == GPIO_ReadInputPortPin(pstcPin->u8SdaPort, pstcPin->u8SdaPin))
+        {
+            enRet = Ok;
+        }
+        else
+        {
+            enRet = Error;
+        }
+
+        GPIO_SetFunc(pstcPin->u8SclPort, pstcPin->u8SclPin, GPIO_FUNC_6_I2C);
+        GPIO_SetFunc(pstcPin->u8SdaPort, pstcPin->u8SdaPin, GPIO_FUNC_6_I2C);
+
+        I2C_SoftwareResetCmd(Enable);
+        I2C_SoftwareResetCmd(Disable);
+    }
+
+    return enRet;
+}
+#endif /* DDL_GPIO_ENABLE */
+
 /**
  * @brief  Initialize I2C peripheral according to the structure
  * @param  [in] pstcI2C_InitStruct   Pointer to I2C configuration structure
@@ -655,6 +1073,1437 @@ en_result_t I2C_StructInit(stc_i2c_init_t* pstcI2C_InitStruct)
     return enRet;
 }
 
+/**
+ * @brief  Start an I2C master transaction (non-blocking).
+ * @param  [in] pstcXfer             Pointer to the transaction @ref stc_i2c_master_xfer_t,
+ *                                   the buffers must be kept until completion
+ * @param  [in] u32Timeout           Transaction timeout in ticks of I2C_MasterTimeoutTick(),
+ *                                   0 for no timeout
+ * @param  [in] pfnCplt              Transaction complete callback, NULL if not used
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Transaction started
+ *           - ErrorInvalidParameter: pstcXfer == NULL or buffer is NULL with length not 0
+ *           - ErrorOperationInProgress: The previous transaction is ongoing
+ *           - ErrorNotReady: The bus is busy
+ * @note   The I2C must be initialized and enabled by I2C_Init()/I2C_Cmd()
+ *         before, and the EEI/TXI/RXI/TEI interrupts must be registered to
+ *         call I2C_MasterIrqHandler().
+ *         The write phase is sent with TXI, the last byte is confirmed by
+ *         TEI, then a repeated start begins the read phase, which is
+ *         received with RXI and ended by NACK and stop condition.
+ */
+en_result_t I2C_MasterXferStart(const stc_i2c_master_xfer_t *pstcXfer,
+                                uint32_t u32Timeout,
+                                func_ptr_i2c_cplt_t pfnCplt)
+{
+    return I2cMasterXferStart(pstcXfer, u32Timeout, pfnCplt, 0u);
+}
+
+/**
+ * @brief  Start an I2C master job queue (non-blocking).
+ * @param  [in] pstcJobs             Pointer to the job list @ref stc_i2c_job_t,
+ *                                   the list and buffers must be kept until completion
+ * @param  [in] u16JobNum            Count of jobs in the list
+ * @param  [in] u32Timeout           Timeout of the whole batch in ticks of I2C_MasterTimeoutTick(),
+ *                                   0 for no timeout
+ * @param  [in] pfnBatchCplt         Batch complete callback, NULL if not used
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Queue started
+ *           - ErrorInvalidParameter: pstcJobs == NULL, u16JobNum == 0 or job buffer is NULL with length not 0
+ *           - ErrorOperationInProgress: The previous transaction is ongoing
+ *           - ErrorNotReady: The bus is busy
+ * @note   Each job sends the register address, then writes or reads u16Len
+ *         bytes. Jobs run back-to-back in the I2C interrupts: a job done
+ *         successfully is followed by the next one with a repeated start,
+ *         a failed job is ended by stop condition and the next one starts
+ *         after it. The result of each job is written to its enResult,
+ *         jobs not run for timeout or abort keep ErrorOperationInProgress.
+ *         pfnBatchCplt is called once with Ok if all jobs succeeded, else
+ *         with Error or ErrorTimeout.
+ */
+en_result_t I2C_MasterQueueStart(stc_i2c_job_t *pstcJobs,
+                                 uint16_t u16JobNum,
+                                 uint32_t u32Timeout,
+                                 func_ptr_i2c_cplt_t pfnBatchCplt)
+{
+    uint16_t i;
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if ((NULL != pstcJobs) && (0u != u16JobNum))
+    {
+        enRet = Ok;
+        for (i = 0u; i < u16JobNum; i++)
+        {
+            DDL_ASSERT(IS_VALID_7BIT_ADR(pstcJobs[i].u8SlaveAdr));
+            DDL_ASSERT(IS_VALID_JOB_DIR(pstcJobs[i].u8Dir));
+
+            if ((NULL == pstcJobs[i].pu8Buf) && (0u != pstcJobs[i].u16Len))
+            {
+                enRet = ErrorInvalidParameter;
+            }
+        }
+
+        if (Ok == enRet)
+        {
+            if (I2C_MASTER_STATE_IDLE != m_stcI2cMaster.u8State)
+            {
+                enRet = ErrorOperationInProgress;
+            }
+            else if (0u != READ_REG32_BIT(M0P_I2C->SR, I2C_SR_BUSY))
+            {
+                enRet = ErrorNotReady;
+            }
+            else
+            {
+                for (i = 0u; i < u16JobNum; i++)
+                {
+                    pstcJobs[i].enResult = ErrorOperationInProgress;
+                }
+
+                m_stcI2cMaster.pfnCplt = pfnBatchCplt;
+                m_stcI2cMaster.u32TimeoutCnt = u32Timeout;
+                m_stcI2cMaster.enResult = ErrorOperationInProgress;
+                m_stcI2cMaster.pstcJob = pstcJobs;
+                m_stcI2cMaster.u16JobRemain = u16JobNum;
+                m_stcI2cMaster.enBatchResult = Ok;
+
+                I2cMasterLoadJob();
+                I2cMasterKick();
+            }
+        }
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  I2C master transaction engine IRQ handler.
+ * @param  None
+ * @retval None
+ * @note   Call this function in the EEI, TXI, RXI and TEI IRQ callbacks.
+ *         Address or write data NACK stops the transaction with Error,
+ *         arbitration lost ends it with Error without stop condition.
+ */
+void I2C_MasterIrqHandler(void)
+{
+    uint32_t u32Status;
+
+    if (I2C_MASTER_STATE_IDLE != m_stcI2cMaster.u8State)
+    {
+        u32Status = READ_REG32(M0P_I2C->SR);
+
+        if (0u != (u32Status & I2C_SR_ARLOF))
+        {
+            I2C_ClearStatus(I2C_CLR_ARLOFCLR);
+            I2cMasterFinish(Error);
+        }
+        else if ((0u != (u32Status & I2C_SR_NACKF)) &&                         \
+                 (0u != (u32Status & I2C_SR_TRA)) &&                           \
+                 (I2C_MASTER_STATE_STOP != m_stcI2cMaster.u8State))
+        {
+            /* Address or data is not acknowledged, read DRR to release SCL */
+            I2C_ClearStatus(I2C_CLR_NACKFCLR);
+            (void)I2C_ReadData();
+            I2cMasterStop(Error);
+        }
+        else
+        {
+            switch (m_stcI2cMaster.u8State)
+            {
+                case I2C_MASTER_STATE_START:
+                case I2C_MASTER_STATE_RESTART:
+                    if (0u != (u32Status & I2C_SR_STARTF))
+                    {
+                        I2C_ClearStatus(I2C_CLR_STARTFCLR);
+                        I2cMasterSendAdr();
+                    }
+                    break;
+                case I2C_MASTER_STATE_TX:
+                    I2cMasterTxProcess(u32Status);
+                    break;
+                case I2C_MASTER_STATE_RX:
+                    I2cMasterRxProcess(u32Status);
+                    break;
+                case I2C_MASTER_STATE_STOP:
+                    if (0u != (u32Status & I2C_SR_STOPF))
+                    {
+                        I2C_ClearStatus(I2C_CLR_STOPFCLR | I2C_CLR_NACKFCLR);
+                        I2cMasterFinish(m_stcI2cMaster.enResult);
+                    }
+                    break;
+                default:
+                    break;
+            }
+        }
+    }
+}
+
+/**
+ * @brief  I2C master transaction timeout tick.
+ * @param  None
+ * @retval None
+ * @note   Call this function periodically, such as in SysTick_IrqHandler()
+ *         every 1ms, the unit of the timeout of I2C_MasterXferStart() is
+ *         the calling period. The transaction is stopped and completed
+ *         with ErrorTimeout when the timeout expires.
+ */
+void I2C_MasterTimeoutTick(void)
+{
+    uint32_t u32Primask;
+    uint8_t u8Expired = 0u;
+
+    u32Primask = __get_PRIMASK();
+    __disable_irq();
+
+    if ((I2C_MASTER_STATE_IDLE != m_stcI2cMaster.u8State) && (0ul != m_stcI2cMaster.u32TimeoutCnt))
+    {
+        m_stcI2cMaster.u32TimeoutCnt--;
+        if (0ul == m_stcI2cMaster.u32TimeoutCnt)
+        {
+            (void)I2C_MasterAbort();
+            m_stcI2cMaster.enResult = ErrorTimeout;
+            u8Expired = 1u;
+        }
+    }
+
+    __set_PRIMASK(u32Primask);
+
+    if ((0u != u8Expired) && (NULL != m_stcI2cMaster.pfnCplt))
+    {
+        m_stcI2cMaster.pfnCplt(ErrorTimeout);
+    }
+}
+
+/**
+ * @brief  Abort the ongoing I2C master transaction.
+ * @param  None
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Abort successfully
+ * @note   Stop condition is generated if the bus is owned, the transaction
+ *         complete callback is not called.
+ */
+en_result_t I2C_MasterAbort(void)
+{
+    if (I2C_MASTER_STATE_IDLE != m_stcI2cMaster.u8State)
+    {
+        I2C_IntCmd(I2C_MASTER_INT_MASK, Disable);
+        I2cMasterDmaStop();
+        if (0u != READ_REG32_BIT(M0P_I2C->SR, I2C_SR_MSL))
+        {
+            I2C_GenerateStop();
+        }
+        I2C_NackConfig(Disable);
+        if (0u != m_stcI2cMaster.u8BlockRd)
+        {
+            I2C_FastAckConfig((0u != m_stcI2cMaster.u8FastAck) ? Enable : Disable);
+        }
+        m_stcI2cMaster.enResult = Error;
+        m_stcI2cMaster.u8State = I2C_MASTER_STATE_IDLE;
+    }
+
+    return Ok;
+}
+
+/**
+ * @brief  Get the result of the I2C master transaction.
+ * @param  None
+ * @retval An en_result_t enumeration value:
+ *           - Ok: The last transaction is completed successfully
+ *           - Error: NACK, arbitration lost or aborted
+ *           - ErrorTimeout: The last transaction is timeout
+ *           - ErrorOperationInProgress: The transaction is ongoing
+ */
+en_result_t I2C_MasterGetResult(void)
+{
+    return m_stcI2cMaster.enResult;
+}
+
+#if (DDL_DMA_ENABLE == DDL_ON)
+/**
+ * @brief  Enable or disable DMA for the data phase of the I2C master engine.
+ * @param  [in] u8DmaCh              DMA channel, DMA_CHANNEL_0 or DMA_CHANNEL_1
+ * @param  [in] enNewState           Enable: data phases of I2C_MASTER_DMA_MIN_SIZE bytes or more
+ *                                   are moved by DMA, Disable: all bytes are moved by CPU
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Configured successfully
+ *           - ErrorOperationInProgress: A transaction is ongoing
+ * @note   The function clocks of DMA and AOS must be enabled, DMA must be
+ *         enabled by DMA_Cmd() and I2C_MasterDmaIrqHandler() must be called
+ *         in the transfer complete IRQ callback of the channel.
+ * @note   The write and read phases never overlap, so one channel serves both.
+ *         By the state machine, a write of N bytes takes 4 interrupts (start,
+ *         DMA complete, transmit end, stop) instead of N + 3, and a read takes
+ *         5 (start, DMA complete, last 2 bytes, stop) instead of N + 2. Every
+ *         1023 bytes add one DMA complete interrupt.
+ */
+en_result_t I2C_MasterDmaCmd(uint8_t u8DmaCh, en_functional_state_t enNewState)
+{
+    en_result_t enRet = ErrorOperationInProgress;
+
+    DDL_ASSERT((DMA_CHANNEL_0 == u8DmaCh) || (DMA_CHANNEL_1 == u8DmaCh));
+    DDL_ASSERT(IS_FUNCTIONAL_STATE(enNewState));
+
+    if (I2C_MASTER_STATE_IDLE == m_stcI2cMaster.u8State)
+    {
+        m_stcI2cMaster.u8DmaCh = u8DmaCh;
+        m_stcI2cMaster.u8DmaEn = (Enable == enNewState) ? 1u : 0u;
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  I2C master engine DMA transfer complete IRQ handler.
+ * @param  None
+ * @retval None
+ * @note   Call this function in the transfer complete IRQ callback of the
+ *         channel set by I2C_MasterDmaCmd().
+ */
+void I2C_MasterDmaIrqHandler(void)
+{
+    stc_i2c_master_ctx_t *pstcCtx = &m_stcI2cMaster;
+
+    if ((0u != pstcCtx->u8DmaEn) && (Set == DMA_GetCplFlag(pstcCtx->u8DmaCh, DMA_FLAG_TC)))
+    {
+        DMA_ClearCplFlag(pstcCtx->u8DmaCh, DMA_FLAG_TC);
+        DMA_CplIrqCmd(pstcCtx->u8DmaCh, DMA_IRQ_TC, Disable);
+
+        if (I2C_MASTER_STATE_TX == pstcCtx->u8State)
+        {
+            if (pstcCtx->u16TxIdx < I2cMasterTxTotal())
+            {
+                /* More than I2C_MASTER_DMA_MAX_SIZE bytes, continue by CPU */
+                I2C_IntCmd(I2C_CR2_TEMPTYIE, Enable);
+            }
+            else
+            {
+                I2C_IntCmd(I2C_CR2_TENDIE, Enable);
+            }
+        }
+        else if (I2C_MASTER_STATE_RX == pstcCtx->u8State)
+        {
+            /* Remaining bytes, at least the last 2, are read by CPU */
+            I2C_IntCmd(I2C_CR2_RFULLIE, Enable);
+        }
+    }
+}
+#endif /* DDL_DMA_ENABLE */
+
+/**
+ * @brief  Enable or disable SMBus Packet Error Checking.
+ * @param  [in] enNewState           Enable: the SMBus transactions are sent and
+ *                                   checked with PEC, Disable: without PEC
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Configured successfully
+ *           - ErrorOperationInProgress: A transaction is ongoing
+ * @note   PEC is the CRC-8 (x^8 + x^2 + x + 1) of all bytes of the
+ *         transaction including the address bytes, it is computed byte by
+ *         byte in the ISR as the data moves. A received PEC mismatch ends
+ *         the transaction with Error.
+ */
+en_result_t I2C_SmbusPecCmd(en_functional_state_t enNewState)
+{
+    en_result_t enRet = ErrorOperationInProgress;
+
+    DDL_ASSERT(IS_FUNCTIONAL_STATE(enNewState));
+
+    if (I2C_MASTER_STATE_IDLE == m_stcI2cMaster.u8State)
+    {
+        m_stcI2cSmbus.u8PecEn = (Enable == enNewState) ? 1u : 0u;
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Start an SMBus block write (non-blocking).
+ * @param  [in] u8SlaveAdr           7-bit slave address
+ * @param  [in] u8Cmd                Command code
+ * @param  [in] pu8Data              Data to be written, copied before return
+ * @param  [in] u8Count              Byte count, 1 ~ I2C_SMBUS_BLOCK_MAX
+ * @param  [in] u32Timeout           Transaction timeout in ticks of I2C_MasterTimeoutTick(),
+ *                                   0 for no timeout
+ * @param  [in] pfnCplt              Transaction complete callback, NULL if not used
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Transaction started
+ *           - ErrorInvalidParameter: pu8Data == NULL or u8Count is out of range
+ *           - ErrorOperationInProgress: The previous transaction is ongoing
+ *           - ErrorNotReady: The bus is busy
+ * @note   S Adr+W Cmd Count Data[0] ... Data[Count-1] [PEC] P
+ */
+en_result_t I2C_SmbusBlockWrite(uint8_t u8SlaveAdr,
+                                uint8_t u8Cmd,
+                                const uint8_t *pu8Data,
+                                uint8_t u8Count,
+                                uint32_t u32Timeout,
+                                func_ptr_i2c_cplt_t pfnCplt)
+{
+    stc_i2c_master_xfer_t stcXfer;
+    uint8_t i;
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if ((NULL != pu8Data) && (0u != u8Count) && (u8Count <= I2C_SMBUS_BLOCK_MAX))
+    {
+        if (I2C_MASTER_STATE_IDLE != m_stcI2cMaster.u8State)
+        {
+            enRet = ErrorOperationInProgress;
+        }
+        else
+        {
+            m_stcI2cSmbus.au8Tx[0] = u8Cmd;
+            m_stcI2cSmbus.au8Tx[1] = u8Count;
+            for (i = 0u; i < u8Count; i++)
+            {
+                m_stcI2cSmbus.au8Tx[2u + i] = pu8Data[i];
+            }
+
+            stcXfer.u8SlaveAdr = u8SlaveAdr;
+            stcXfer.pu8TxBuf = m_stcI2cSmbus.au8Tx;
+            stcXfer.u16TxLen = (uint16_t)u8Count + 2u;
+            stcXfer.pu8RxBuf = NULL;
+            stcXfer.u16RxLen = 0u;
+            enRet = I2cMasterXferStart(&stcXfer, u32Timeout, pfnCplt,
+                                       (0u != m_stcI2cSmbus.u8PecEn) ? I2C_SMBUS_OPT_PEC : 0u);
+        }
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Start an SMBus block read (non-blocking).
+ * @param  [in] u8SlaveAdr           7-bit slave address
+ * @param  [in] u8Cmd                Command code
+ * @param  [out] pu8Block            Buffer of I2C_SMBUS_BLOCK_MAX + 1 bytes, pu8Block[0]
+ *                                   is the byte count and the data follows
+ * @param  [in] u32Timeout           Transaction timeout in ticks of I2C_MasterTimeoutTick(),
+ *                                   0 for no timeout
+ * @param  [in] pfnCplt              Transaction complete callback, NULL if not used
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Transaction started
+ *           - ErrorInvalidParameter: pu8Block == NULL
+ *           - ErrorOperationInProgress: The previous transaction is ongoing
+ *           - ErrorNotReady: The bus is busy
+ * @note   S Adr+W Cmd Sr Adr+R Count Data[0] ... Data[Count-1] [PEC] P
+ *         The read length follows the byte count received. Fast ACK is off
+ *         while the count is read, so a count of 0 or above I2C_SMBUS_BLOCK_MAX
+ *         is NACKed and ends the transaction with Error.
+ */
+en_result_t I2C_SmbusBlockRead(uint8_t u8SlaveAdr,
+                               uint8_t u8Cmd,
+                               uint8_t *pu8Block,
+                               uint32_t u32Timeout,
+                               func_ptr_i2c_cplt_t pfnCplt)
+{
+    stc_i2c_master_xfer_t stcXfer;
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if (NULL != pu8Block)
+    {
+        if (I2C_MASTER_STATE_IDLE != m_stcI2cMaster.u8State)
+        {
+            enRet = ErrorOperationInProgress;
+        }
+        else
+        {
+            m_stcI2cSmbus.au8Tx[0] = u8Cmd;
+
+            stcXfer.u8SlaveAdr = u8SlaveAdr;
+            stcXfer.pu8TxBuf = m_stcI2cSmbus.au8Tx;
+            stcXfer.u16TxLen = 1u;
+            stcXfer.pu8RxBuf = pu8Block;
+            stcXfer.u16RxLen = 1u + I2C_SMBUS_BLOCK_MAX;
+            enRet = I2cMasterXferStart(&stcXfer, u32Timeout, pfnCplt,
+                                       I2C_SMBUS_OPT_BLOCK_RD |
+                                       ((0u != m_stcI2cSmbus.u8PecEn) ? I2C_SMBUS_OPT_PEC : 0u));
+        }
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Start an SMBus process call (non-blocking).
+ * @param  [in] u8SlaveAdr           7-bit slave address
+ * @param  [in] u8Cmd                Command code
+ * @param  [in] u16Data              Data word to be written
+ * @param  [out] pu8Result           Buffer of 2 bytes for the data word read, low byte first
+ * @param  [in] u32Timeout           Transaction timeout in ticks of I2C_MasterTimeoutTick(),
+ *                                   0 for no timeout
+ * @param  [in] pfnCplt              Transaction complete callback, NULL if not used
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Transaction started
+ *           - ErrorInvalidParameter: pu8Result == NULL
+ *           - ErrorOperationInProgress: The previous transaction is ongoing
+ *           - ErrorNotReady: The bus is busy
+ * @note   S Adr+W Cmd DataL DataH Sr Adr+R DataL DataH [PEC] P
+ */
+en_result_t I2C_SmbusProcessCall(uint8_t u8SlaveAdr,
+                                 uint8_t u8Cmd,
+                                 uint16_t u16Data,
+                                 uint8_t *pu8Result,
+                                 uint32_t u32Timeout,
+                                 func_ptr_i2c_cplt_t pfnCplt)
+{
+    stc_i2c_master_xfer_t stcXfer;
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if (NULL != pu8Result)
+    {
+        if (I2C_MASTER_STATE_IDLE != m_stcI2cMaster.u8State)
+        {
+            enRet = ErrorOperationInProgress;
+        }
+        else
+        {
+            m_stcI2cSmbus.au8Tx[0] = u8Cmd;
+            m_stcI2cSmbus.au8Tx[1] = (uint8_t)u16Data;
+            m_stcI2cSmbus.au8Tx[2] = (uint8_t)(u16Data >> 8u);
+
+            stcXfer.u8SlaveAdr = u8SlaveAdr;
+            stcXfer.pu8TxBuf = m_stcI2cSmbus.au8Tx;
+            stcXfer.u16TxLen = 3u;
+            stcXfer.pu8RxBuf = pu8Result;
+            stcXfer.u16RxLen = 2u;
+            enRet = I2cMasterXferStart(&stcXfer, u32Timeout, pfnCplt,
+                                       (0u != m_stcI2cSmbus.u8PecEn) ? I2C_SMBUS_OPT_PEC : 0u);
+        }
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Read the alert response address to find the alerting device (non-blocking).
+ * @param  [out] pu8Adr              Byte read, the 7-bit address of the device is (*pu8Adr >> 1)
+ * @param  [in] u32Timeout           Transaction timeout in ticks of I2C_MasterTimeoutTick(),
+ *                                   0 for no timeout
+ * @param  [in] pfnCplt              Transaction complete callback, NULL if not used
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Transaction started
+ *           - ErrorInvalidParameter: pu8Adr == NULL
+ *           - ErrorOperationInProgress: The previous transaction is ongoing
+ *           - ErrorNotReady: The bus is busy
+ * @note   Call it when the SMBALERT# line is asserted, the device with the
+ *         lowest address wins the arbitration and releases SMBALERT#. Read
+ *         again while SMBALERT# is still asserted.
+ */
+en_result_t I2C_SmbusAlertQuery(uint8_t *pu8Adr, uint32_t u32Timeout, func_ptr_i2c_cplt_t pfnCplt)
+{
+    stc_i2c_master_xfer_t stcXfer;
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if (NULL != pu8Adr)
+    {
+        stcXfer.u8SlaveAdr = I2C_SMBUS_ALERT_RESPONSE_ADR;
+        stcXfer.pu8TxBuf = NULL;
+        stcXfer.u16TxLen = 0u;
+        stcXfer.pu8RxBuf = pu8Adr;
+        stcXfer.u16RxLen = 1u;
+        enRet = I2cMasterXferStart(&stcXfer, u32Timeout, pfnCplt,
+                                   (0u != m_stcI2cSmbus.u8PecEn) ? I2C_SMBUS_OPT_PEC : 0u);
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Request the SMBus alert response as a device.
+ * @param  [in] u8OwnAdr             7-bit own address sent in the alert response
+ * @param  [in] pfnCplt              Called with Ok in the ISR when the host
+ *                                   has read the own address, NULL if not used
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Alert response armed
+ *           - ErrorOperationInProgress: The previous alert is not responded
+ * @note   The alert response address must be enabled by
+ *         I2C_SmbusConfig(I2C_SMBUS_ALRTEN) and I2C_SmBusCmd(Enable), and
+ *         I2C_SmbusAlertIrqHandler() must be called in the EEI and TXI IRQ
+ *         callbacks. The application drives SMBALERT# low before calling
+ *         this function and releases it in pfnCplt.
+ */
+en_result_t I2C_SmbusAlertRaise(uint8_t u8OwnAdr, func_ptr_i2c_cplt_t pfnCplt)
+{
+    en_result_t enRet = ErrorOperationInProgress;
+
+    DDL_ASSERT(IS_VALID_7BIT_ADR(u8OwnAdr));
+
+    if (I2C_SMBUS_ALERT_IDLE == m_stcI2cSmbus.u8AlertState)
+    {
+        m_stcI2cSmbus.u8AlertAdr = u8OwnAdr;
+        m_stcI2cSmbus.pfnAlertCplt = pfnCplt;
+        m_stcI2cSmbus.u8AlertState = I2C_SMBUS_ALERT_RAISED;
+
+        I2C_ClearStatus(I2C_CLR_SMBALRTFCLR);
+        I2C_IntCmd(I2C_CR2_SMBALRTIE, Enable);
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  SMBus alert response IRQ handler of the device.
+ * @param  None
+ * @retval None
+ * @note   The own address is sent when the host reads the alert response
+ *         address (SMBALRTF). If the arbitration is lost to a device with
+ *         a lower address, the alert stays raised for the next read.
+ */
+void I2C_SmbusAlertIrqHandler(void)
+{
+    stc_i2c_smbus_ctx_t *pstcCtx = &m_stcI2cSmbus;
+    uint32_t u32Status = READ_REG32(M0P_I2C->SR);
+
+    if (I2C_SMBUS_ALERT_RAISED == pstcCtx->u8AlertState)
+    {
+        if ((0u != (u32Status & I2C_SR_SMBALRTF)) && (0u != (u32Status & I2C_SR_TRA)))
+        {
+            I2C_ClearStatus(I2C_CLR_SMBALRTFCLR | I2C_CLR_NACKFCLR | I2C_CLR_ARLOFCLR);
+            I2C_SendData((uint8_t)(pstcCtx->u8AlertAdr << 1u));
+            pstcCtx->u8AlertState = I2C_SMBUS_ALERT_RESPOND;
+            I2C_IntCmd(I2C_CR2_NACKIE | I2C_CR2_ARLOIE, Enable);
+        }
+    }
+    else if (I2C_SMBUS_ALERT_RESPOND == pstcCtx->u8AlertState)
+    {
+        if (0u != (u32Status & I2C_SR_ARLOF))
+        {
+            I2C_ClearStatus(I2C_CLR_ARLOFCLR);
+            I2C_IntCmd(I2C_CR2_NACKIE | I2C_CR2_ARLOIE, Disable);
+            pstcCtx->u8AlertState = I2C_SMBUS_ALERT_RAISED;
+        }
+        else if (0u != (u32Status & I2C_SR_NACKF))
+        {
+            /* The host has read the address, read DRR to release SCL */
+            I2C_ClearStatus(I2C_CLR_NACKFCLR);
+            (void)I2C_ReadData();
+            I2C_IntCmd(I2C_CR2_NACKIE | I2C_CR2_ARLOIE | I2C_CR2_SMBALRTIE, Disable);
+            pstcCtx->u8AlertState = I2C_SMBUS_ALERT_IDLE;
+
+            if (NULL != pstcCtx->pfnAlertCplt)
+            {
+                pstcCtx->pfnAlertCplt(Ok);
+            }
+        }
+    }
+}
+
+/**
+ * @brief  Start the I2C slave register map engine for one slave address.
+ * @param  [in] u32AdrNum            I2C_ADR_0 or I2C_ADR_1 @ref I2C_Adr_Num
+ * @param  [in] pstcMap              Pointer to a @ref stc_i2c_slave_regmap_t structure
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Started successfully
+ *           - ErrorInvalidParameter: pstcMap == NULL, pu8Reg == NULL or
+ *                                    u16RegNum is out of range
+ * @note   The slave address is set by I2C_SlaveAdrConfig() with the same
+ *         u32AdrNum, SLADDR0 and SLADDR1 can serve two independent maps.
+ *         The map structure is copied, the register file must stay valid.
+ * @note   Call I2C_SlaveIrqHandler() in the EEI, TXI, RXI and TEI IRQ callbacks.
+ *         Registers are read and written from RAM inside the ISR, the next
+ *         byte is loaded as soon as DTR is empty, so SCL is only stretched
+ *         for the interrupt latency and the read callback.
+ */
+en_result_t I2C_SlaveRegMapStart(uint32_t u32AdrNum, const stc_i2c_slave_regmap_t *pstcMap)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+
+    DDL_ASSERT(IS_VALID_ADR_NUM(u32AdrNum));
+
+    if ((NULL != pstcMap) && (NULL != pstcMap->pu8Reg) &&                      \
+        (0u != pstcMap->u16RegNum) && (pstcMap->u16RegNum <= I2C_SLAVE_REG_NUM_MAX))
+    {
+        I2C_IntCmd((I2C_ADR_0 == u32AdrNum) ? I2C_CR2_SLADDR0IE : I2C_CR2_SLADDR1IE, Disable);
+        m_stcI2cSlave.astcMap[u32AdrNum] = *pstcMap;
+        m_stcI2cSlave.au16Ptr[u32AdrNum] = 0u;
+
+        I2C_ClearStatus((I2C_ADR_0 == u32AdrNum) ? I2C_CLR_SLADDR0FCLR : I2C_CLR_SLADDR1FCLR);
+        I2C_IntCmd((I2C_ADR_0 == u32AdrNum) ? I2C_CR2_SLADDR0IE : I2C_CR2_SLADDR1IE, Enable);
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Stop the I2C slave register map engine for one slave address.
+ * @param  [in] u32AdrNum            I2C_ADR_0 or I2C_ADR_1 @ref I2C_Adr_Num
+ * @retval None
+ * @note   The slave address is still acknowledged by hardware until it is
+ *         disabled by I2C_SlaveAdrConfig() with I2C_ADR_CONFIG_DISEN.
+ */
+void I2C_SlaveRegMapStop(uint32_t u32AdrNum)
+{
+    DDL_ASSERT(IS_VALID_ADR_NUM(u32AdrNum));
+
+    I2C_IntCmd((I2C_ADR_0 == u32AdrNum) ? I2C_CR2_SLADDR0IE : I2C_CR2_SLADDR1IE, Disable);
+    if (&m_stcI2cSlave.astcMap[u32AdrNum] == m_stcI2cSlave.pstcMap)
+    {
+        I2C_IntCmd(I2C_SLAVE_XFER_INT_MASK, Disable);
+        m_stcI2cSlave.pstcMap = NULL;
+    }
+    m_stcI2cSlave.astcMap[u32AdrNum].pu8Reg = NULL;
+}
+
+/**
+ * @brief  I2C slave register map engine IRQ handler.
+ * @param  None
+ * @retval None
+ * @note   Call this function in the EEI, TXI, RXI and TEI IRQ callbacks.
+ *         A restart to the other address completes the ongoing write phase
+ *         and switches the register map, each map keeps its own pointer.
+ */
+void I2C_SlaveIrqHandler(void)
+{
+    stc_i2c_slave_ctx_t *pstcCtx = &m_stcI2cSlave;
+    uint32_t u32Status = READ_REG32(M0P_I2C->SR);
+    uint32_t u32IntEn = READ_REG32(M0P_I2C->CR2);
+    uint32_t u32AdrNum;
+    uint8_t u8Data;
+
+    if (0u != (u32Status & (I2C_SR_SLADDR0F | I2C_SR_SLADDR1F)))
+    {
+        I2C_ClearStatus(I2C_CLR_SLADDR0FCLR | I2C_CLR_SLADDR1FCLR | I2C_CLR_NACKFCLR);
+        I2cSlaveWriteDone();
+
+        u32AdrNum = (0u != (u32Status & I2C_SR_SLADDR0F)) ? I2C_ADR_0 : I2C_ADR_1;
+        pstcCtx->pstcMap = &pstcCtx->astcMap[u32AdrNum];
+        pstcCtx->pu16Ptr = &pstcCtx->au16Ptr[u32AdrNum];
+
+        if (NULL == pstcCtx->pstcMap->pu8Reg)
+        {
+            /* Register map of the address is stopped */
+            pstcCtx->pstcMap = NULL;
+        }
+        else if (0u != (u32Status & I2C_SR_TRA))
+        {
+            /* Read: the pointer is kept from the previous write phase */
+            I2C_IntCmd(I2C_CR2_RFULLIE, Disable);
+            if (NULL != pstcCtx->pstcMap->pfnRead)
+            {
+                pstcCtx->pstcMap->pfnRead((uint8_t)*pstcCtx->pu16Ptr);
+            }
+            I2C_SendData(I2cSlaveReadNext());
+            I2C_IntCmd(I2C_CR2_TEMPTYIE | I2C_CR2_STOPIE | I2C_CR2_NACKIE, Enable);
+        }
+        else
+        {
+            I2C_IntCmd(I2C_CR2_TEMPTYIE, Disable);
+            pstcCtx->u8PtrSet = 0u;
+            I2C_IntCmd(I2C_CR2_RFULLIE | I2C_CR2_STOPIE | I2C_CR2_NACKIE, Enable);
+        }
+    }
+    else if (NULL != pstcCtx->pstcMap)
+    {
+        if ((0u != (u32Status & I2C_SR_RFULLF)) && (0u != (u32IntEn & I2C_CR2_RFULLIE)))
+        {
+            u8Data = I2C_ReadData();
+            if (0u == pstcCtx->u8PtrSet)
+            {
+                *pstcCtx->pu16Ptr = (uint16_t)u8Data % pstcCtx->pstcMap->u16RegNum;
+                pstcCtx->u8WrReg = (uint8_t)*pstcCtx->pu16Ptr;
+                pstcCtx->u16WrCnt = 0u;
+                pstcCtx->u8PtrSet = 1u;
+            }
+            else
+            {
+                pstcCtx->pstcMap->pu8Reg[*pstcCtx->pu16Ptr] = u8Data;
+                (*pstcCtx->pu16Ptr)++;
+                if (*pstcCtx->pu16Ptr >= pstcCtx->pstcMap->u16RegNum)
+                {
+                    *pstcCtx->pu16Ptr = 0u;
+                }
+                pstcCtx->u16WrCnt++;
+            }
+        }
+
+        if ((0u != (u32Status & I2C_SR_TEMPTYF)) && (0u != (u32IntEn & I2C_CR2_TEMPTYIE)) &&  \
+            (0u == (u32Status & I2C_SR_NACKF)))
+        {
+            I2C_SendData(I2cSlaveReadNext());
+        }
+
+        if (0u != (u32Status & I2C_SR_NACKF))
+        {
+            /* The master ends the read, the byte left in DTR is not sent */
+            I2C_ClearStatus(I2C_CLR_NACKFCLR);
+            if (0u != (u32IntEn & I2C_CR2_TEMPTYIE))
+            {
+                I2C_IntCmd(I2C_CR2_TEMPTYIE, Disable);
+                if (0u == *pstcCtx->pu16Ptr)
+                {
+                    *pstcCtx->pu16Ptr = pstcCtx->pstcMap->u16RegNum;
+                }
+                (*pstcCtx->pu16Ptr)--;
+                /* Read DRR register to release SCL */
+                (void)I2C_ReadData();
+            }
+        }
+
+        if (0u != (u32Status & I2C_SR_STOPF))
+        {
+            I2C_IntCmd(I2C_SLAVE_XFER_INT_MASK, Disable);
+            I2C_ClearStatus(I2C_CLR_STOPFCLR | I2C_CLR_NACKFCLR);
+            I2cSlaveWriteDone();
+            pstcCtx->pstcMap = NULL;
+        }
+    }
+    else if (0u != (u32Status & I2C_SR_STOPF))
+    {
+        I2C_ClearStatus(I2C_CLR_STOPFCLR);
+    }
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @addtogroup I2C_Local_Functions I2C Local Functions
+ * @{
+ */
+
+/**
+ * @brief  Send the address byte after start or restart condition.
+ * @param  None
+ * @retval None
+ */
+static void I2cMasterSendAdr(void)
+{
+    const stc_i2c_master_xfer_t *pstcXfer = &m_stcI2cMaster.stcXfer;
+    uint32_t u32TxTotal = I2cMasterTxTotal();
+    uint32_t u32RxTotal = I2cMasterRxTotal();
+    uint16_t u16DmaSize;
+    uint8_t u8Adr;
+
+    if ((I2C_MASTER_STATE_START == m_stcI2cMaster.u8State) &&                  \
+        ((0ul != u32TxTotal) || (0u == pstcXfer->u16RxLen)))
+    {
+        u8Adr = (uint8_t)(pstcXfer->u8SlaveAdr << 1u) | I2C_ADR_DIR_W;
+        I2C_SendData(u8Adr);
+        m_stcI2cMaster.u8Pec = I2cSmbusCrc8(0u, u8Adr);
+        m_stcI2cMaster.u8State = I2C_MASTER_STATE_TX;
+
+        u16DmaSize = I2cMasterDmaSize(pstcXfer->u16TxLen);
+        if ((0u == m_stcI2cMaster.u8RegLen) && (0u != u16DmaSize))
+        {
+            I2cMasterDmaStart(I2C_ADR_DIR_W, u16DmaSize);
+        }
+        else if (0ul != u32TxTotal)
+        {
+            I2C_IntCmd(I2C_CR2_TEMPTYIE, Enable);
+        }
+        else
+        {
+            /* Address only */
+            I2C_IntCmd(I2C_CR2_TENDIE, Enable);
+        }
+    }
+    else
+    {
+        /* Single byte read: NACK the first byte */
+        if (1ul == u32RxTotal)
+        {
+            I2C_NackConfig(Enable);
+        }
+
+        /* The last 2 bytes are always read by CPU to set NACK in time */
+        u16DmaSize = 0u;
+        if (u32RxTotal > 2ul)
+        {
+            u16DmaSize = I2cMasterDmaSize(u32RxTotal - 2ul);
+        }
+
+        u8Adr = (uint8_t)(pstcXfer->u8SlaveAdr << 1u) | I2C_ADR_DIR_R;
+        if (I2C_MASTER_STATE_START == m_stcI2cMaster.u8State)
+        {
+            m_stcI2cMaster.u8Pec = I2cSmbusCrc8(0u, u8Adr);
+        }
+        else
+        {
+            m_stcI2cMaster.u8Pec = I2cSmbusCrc8(m_stcI2cMaster.u8Pec, u8Adr);
+        }
+
+        if (0u != m_stcI2cMaster.u8BlockRd)
+        {
+            /* Fast ACK off: the ACK of the block count is decided after it is checked */
+            I2C_FastAckConfig(Disable);
+        }
+
+        m_stcI2cMaster.u8State = I2C_MASTER_STATE_RX;
+        if (0u != u16DmaSize)
+        {
+            I2cMasterDmaStart(I2C_ADR_DIR_R, u16DmaSize);
+            I2C_SendData(u8Adr);
+        }
+        else
+        {
+            I2C_SendData(u8Adr);
+            I2C_IntCmd(I2C_CR2_RFULLIE, Enable);
+        }
+    }
+}
+
+/**
+ * @brief  Write phase process of the I2C master engine.
+ * @param  [in] u32Status            Value of I2C_SR register
+ * @retval None
+ */
+static void I2cMasterTxProcess(uint32_t u32Status)
+{
+    stc_i2c_master_ctx_t *pstcCtx = &m_stcI2cMaster;
+    uint32_t u32TxTotal = I2cMasterTxTotal();
+    uint32_t u32DataEnd = (uint32_t)pstcCtx->u8RegLen + pstcCtx->stcXfer.u16TxLen;
+    uint16_t u16DmaSize = 0u;
+    uint8_t u8Data;
+
+    if ((0u != (u32Status & I2C_SR_TEMPTYF)) &&                                \
+        (0u != READ_REG32_BIT(M0P_I2C->CR2, I2C_CR2_TEMPTYIE)))
+    {
+        if (pstcCtx->u16TxIdx < u32TxTotal)
+        {
+            if (pstcCtx->u16TxIdx < pstcCtx->u8RegLen)
+            {
+                u8Data = pstcCtx->u8Reg;
+            }
+            else if (pstcCtx->u16TxIdx < u32DataEnd)
+            {
+                u8Data = pstcCtx->stcXfer.pu8TxBuf[pstcCtx->u16TxIdx - pstcCtx->u8RegLen];
+            }
+            else
+            {
+                /* PEC of the write only transaction */
+                u8Data = pstcCtx->u8Pec;
+            }
+            I2C_SendData(u8Data);
+            pstcCtx->u8Pec = I2cSmbusCrc8(pstcCtx->u8Pec, u8Data);
+            pstcCtx->u16TxIdx++;
+        }
+
+        if (pstcCtx->u16TxIdx >= pstcCtx->u8RegLen)
+        {
+            u16DmaSize = I2cMasterDmaSize(u32TxTotal - pstcCtx->u16TxIdx);
+        }
+
+        if (0u != u16DmaSize)
+        {
+            /* DTR is full, DMA moves the following bytes */
+            I2C_IntCmd(I2C_CR2_TEMPTYIE, Disable);
+            I2cMasterDmaStart(I2C_ADR_DIR_W, u16DmaSize);
+        }
+        else if (pstcCtx->u16TxIdx >= u32TxTotal)
+        {
+            /* Last byte is in DTR, wait it transmitted */
+            I2C_IntCmd(I2C_CR2_TEMPTYIE, Disable);
+            I2C_IntCmd(I2C_CR2_TENDIE, Enable);
+        }
+    }
+    else if ((0u != (u32Status & I2C_SR_TENDF)) &&                             \
+             (0u != READ_REG32_BIT(M0P_I2C->CR2, I2C_CR2_TENDIE)))
+    {
+        I2C_IntCmd(I2C_CR2_TENDIE, Disable);
+        I2C_ClearStatus(I2C_CLR_TENDFCLR);
+
+        if (0u != (u32Status & I2C_SR_ACKRF))
+        {
+            I2C_ClearStatus(I2C_CLR_NACKFCLR);
+            I2cMasterStop(Error);
+        }
+        else if (0u != pstcCtx->stcXfer.u16RxLen)
+        {
+            pstcCtx->u8State = I2C_MASTER_STATE_RESTART;
+            I2C_ClearStatus(I2C_CLR_STARTFCLR);
+            I2C_GenerateReStart();
+        }
+        else
+        {
+            I2cMasterXferDone();
+        }
+    }
+}
+
+/**
+ * @brief  Read phase process of the I2C master engine.
+ * @param  [in] u32Status            Value of I2C_SR register
+ * @retval None
+ */
+static void I2cMasterRxProcess(uint32_t u32Status)
+{
+    stc_i2c_master_ctx_t *pstcCtx = &m_stcI2cMaster;
+    uint32_t u32RxTotal;
+    uint8_t u8Data;
+
+    if (0u != (u32Status & I2C_SR_RFULLF))
+    {
+        u8Data = I2C_ReadData();
+        if ((0u != pstcCtx->u8BlockRd) && (0u == pstcCtx->u16RxIdx))
+        {
+            /* SMBus block count: 1 ~ I2C_SMBUS_BLOCK_MAX, NACK an invalid one */
+            if ((0u == u8Data) || (u8Data > I2C_SMBUS_BLOCK_MAX))
+            {
+                I2C_NackConfig(Enable);
+                pstcCtx->u8SmbErr = 1u;
+                u8Data = 0u;
+            }
+            I2C_FastAckConfig((0u != pstcCtx->u8FastAck) ? Enable : Disable);
+            pstcCtx->stcXfer.u16RxLen = (uint16_t)u8Data + 1u;
+        }
+
+        if (pstcCtx->u16RxIdx < pstcCtx->stcXfer.u16RxLen)
+        {
+            pstcCtx->stcXfer.pu8RxBuf[pstcCtx->u16RxIdx] = u8Data;
+            pstcCtx->u8Pec = I2cSmbusCrc8(pstcCtx->u8Pec, u8Data);
+        }
+        else if (u8Data != pstcCtx->u8Pec)
+        {
+            pstcCtx->u8SmbErr = 1u;
+        }
+        pstcCtx->u16RxIdx++;
+
+        u32RxTotal = I2cMasterRxTotal();
+        if ((pstcCtx->u16RxIdx >= u32RxTotal) || (0u != pstcCtx->u8SmbErr))
+        {
+            I2C_IntCmd(I2C_CR2_RFULLIE, Disable);
+            if (0u != pstcCtx->u8SmbErr)
+            {
+                I2cMasterStop(Error);
+            }
+            else
+            {
+                I2cMasterXferDone();
+            }
+        }
+        else if ((pstcCtx->u16RxIdx + 1ul) == u32RxTotal)
+        {
+            /* NACK the last byte */
+            I2C_NackConfig(Enable);
+        }
+    }
+}
+
+/**
+ * @brief  Generate start condition for the loaded transaction.
+ * @param  None
+ * @retval None
+ */
+static void I2cMasterKick(void)
+{
+    m_stcI2cMaster.u8State = I2C_MASTER_STATE_START;
+
+    I2C_NackConfig(Disable);
+    I2C_ClearStatus(I2C_CLR_STARTFCLR | I2C_CLR_STOPFCLR | I2C_CLR_TENDFCLR | \
+                    I2C_CLR_ARLOFCLR  | I2C_CLR_NACKFCLR);
+    I2C_IntCmd(I2C_CR2_STARTIE | I2C_CR2_ARLOIE | I2C_CR2_NACKIE, Enable);
+    I2C_GenerateStart();
+}
+
+/**
+ * @brief  Transaction done successfully: continue with the next job by
+ *         repeated start, or generate stop condition.
+ * @param  None
+ * @retval None
+ */
+static void I2cMasterXferDone(void)
+{
+    stc_i2c_master_ctx_t *pstcCtx = &m_stcI2cMaster;
+
+    if (NULL != pstcCtx->pstcJob)
+    {
+        I2cMasterJobDone(Ok);
+    }
+
+    if ((NULL != pstcCtx->pstcJob) && (0u != pstcCtx->u16JobRemain))
+    {
+        I2cMasterLoadJob();
+        pstcCtx->u8State = I2C_MASTER_STATE_START;
+        I2C_ClearStatus(I2C_CLR_STARTFCLR);
+        I2C_GenerateReStart();
+    }
+    else
+    {
+        I2cMasterStop(pstcCtx->enBatchResult);
+    }
+}
+
+/**
+ * @brief  Generate stop condition and wait it in STOPF interrupt.
+ * @param  [in] enResult             Result of the transaction
+ * @retval None
+ */
+static void I2cMasterStop(en_result_t enResult)
+{
+    I2C_IntCmd(I2C_CR2_TEMPTYIE | I2C_CR2_TENDIE | I2C_CR2_RFULLIE | I2C_CR2_NACKIE, Disable);
+    I2cMasterDmaStop();
+    m_stcI2cMaster.enResult = enResult;
+    m_stcI2cMaster.u8State = I2C_MASTER_STATE_STOP;
+
+    I2C_ClearStatus(I2C_CLR_STOPFCLR);
+    I2C_IntCmd(I2C_CR2_STOPIE, Enable);
+    I2C_GenerateStop();
+}
+
+/**
+ * @brief  Finish the I2C master transaction and call the complete callback.
+ * @param  [in] enResult             Result of the transaction
+ * @retval None
+ */
+static void I2cMasterFinish(en_result_t enResult)
+{
+    stc_i2c_master_ctx_t *pstcCtx = &m_stcI2cMaster;
+
+    I2C_IntCmd(I2C_MASTER_INT_MASK, Disable);
+    I2cMasterDmaStop();
+    I2C_NackConfig(Disable);
+    if (0u != pstcCtx->u8BlockRd)
+    {
+        I2C_FastAckConfig((0u != pstcCtx->u8FastAck) ? Enable : Disable);
+    }
+
+    if (NULL != pstcCtx->pstcJob)
+    {
+        /* The current job is ended by error */
+        if (0u != pstcCtx->u16JobRemain)
+        {
+            I2cMasterJobDone(enResult);
+        }
+        enResult = pstcCtx->enBatchResult;
+    }
+
+    if ((NULL != pstcCtx->pstcJob) && (0u != pstcCtx->u16JobRemain))
+    {
+        I2cMasterLoadJob();
+        I2cMasterKick();
+    }
+    else
+    {
+        pstcCtx->u32TimeoutCnt = 0ul;
+        pstcCtx->enResult = enResult;
+        pstcCtx->u8State = I2C_MASTER_STATE_IDLE;
+
+        if (NULL != pstcCtx->pfnCplt)
+        {
+            pstcCtx->pfnCplt(enResult);
+        }
+    }
+}
+
+/**
+ * @brief  Load the current job of the queue to the transaction.
+ * @param  None
+ * @retval None
+ */
+static void I2cMasterLoadJob(void)
+{
+    stc_i2c_master_ctx_t *pstcCtx = &m_stcI2cMaster;
+    const stc_i2c_job_t *pstcJob = pstcCtx->pstcJob;
+
+    pstcCtx->stcXfer.u8SlaveAdr = pstcJob->u8SlaveAdr;
+    pstcCtx->u8Reg = pstcJob->u8Reg;
+    pstcCtx->u8RegLen = 1u;
+
+    if (I2C_JOB_DIR_READ == pstcJob->u8Dir)
+    {
+        pstcCtx->stcXfer.pu8TxBuf = NULL;
+        pstcCtx->stcXfer.u16TxLen = 0u;
+        pstcCtx->stcXfer.pu8RxBuf = pstcJob->pu8Buf;
+        pstcCtx->stcXfer.u16RxLen = pstcJob->u16Len;
+    }
+    else
+    {
+        pstcCtx->stcXfer.pu8TxBuf = pstcJob->pu8Buf;
+        pstcCtx->stcXfer.u16TxLen = pstcJob->u16Len;
+        pstcCtx->stcXfer.pu8RxBuf = NULL;
+        pstcCtx->stcXfer.u16RxLen = 0u;
+    }
+
+    pstcCtx->u16TxIdx = 0u;
+    pstcCtx->u16RxIdx = 0u;
+    pstcCtx->u8PecEn = 0u;
+    pstcCtx->u8BlockRd = 0u;
+    pstcCtx->u8SmbErr = 0u;
+    I2C_NackConfig(Disable);
+}
+
+/**
+ * @brief  Record the result of the current job and move to the next one.
+ * @param  [in] enResult             Result of the current job
+ * @retval None
+ */
+static void I2cMasterJobDone(en_result_t enResult)
+{
+    stc_i2c_master_ctx_t *pstcCtx = &m_stcI2cMaster;
+
+    pstcCtx->pstcJob->enResult = enResult;
+    if (Ok != enResult)
+    {
+        pstcCtx->enBatchResult = Error;
+    }
+
+    pstcCtx->u16JobRemain--;
+    if (0u != pstcCtx->u16JobRemain)
+    {
+        pstcCtx->pstcJob++;
+    }
+}
+
+/**
+ * @brief  Get the size of the data phase moved by DMA.
+ * @param  [in] u32Len               Remaining bytes of the data phase
+ * @retval Bytes moved by DMA, 0: the data phase is moved by CPU
+ */
+static uint16_t I2cMasterDmaSize(uint32_t u32Len)
+{
+    uint16_t u16Size = 0u;
+
+    /* PEC and block count are processed byte by byte */
+    if ((0u != m_stcI2cMaster.u8DmaEn) && (u32Len >= I2C_MASTER_DMA_MIN_SIZE) &&  \
+        (0u == m_stcI2cMaster.u8PecEn) && (0u == m_stcI2cMaster.u8BlockRd))
+    {
+        if (u32Len > I2C_MASTER_DMA_MAX_SIZE)
+        {
+            u32Len = I2C_MASTER_DMA_MAX_SIZE;
+        }
+        u16Size = (uint16_t)u32Len;
+    }
+
+    return u16Size;
+}
+
+/**
+ * @brief  Start the DMA channel for the data phase.
+ * @param  [in] u8Dir                I2C_ADR_DIR_W: write phase, I2C_ADR_DIR_R: read phase
+ * @param  [in] u16Size              Bytes moved by DMA
+ * @retval None
+ * @note   The index of the data phase is advanced by u16Size, the channel is
+ *         triggered by the TXI/RXI event, the I2C interrupt of the data
+ *         phase is re-enabled in I2C_MasterDmaIrqHandler().
+ */
+static void I2cMasterDmaStart(uint8_t u8Dir, uint16_t u16Size)
+{
+#if (DDL_DMA_ENABLE == DDL_ON)
+    stc_i2c_master_ctx_t *pstcCtx = &m_stcI2cMaster;
+    stc_dma_ch_cfg_t stcDmaChCfg;
+
+    stcDmaChCfg.u32DataWidth = DMA_DATAWIDTH_8BIT;
+    stcDmaChCfg.u32BlockSize = 1ul;
+    stcDmaChCfg.u32TransferCnt = (uint32_t)u16Size;
+
+    if (I2C_ADR_DIR_W == u8Dir)
+    {
+        stcDmaChCfg.u32SrcAddr = (uint32_t)&pstcCtx->stcXfer.pu8TxBuf[pstcCtx->u16TxIdx - pstcCtx->u8RegLen];
+        stcDmaChCfg.u32SrcInc = DMA_SRCADDRINC_INC;
+        stcDmaChCfg.u32DesAddr = (uint32_t)&M0P_I2C->DTR;
+        stcDmaChCfg.u32DesInc = DMA_DESADDRINC_FIX;
+        DMA_ChannelCfg(pstcCtx->u8DmaCh, &stcDmaChCfg);
+        DMA_SetTriggerSrc(pstcCtx->u8DmaCh, EVT_IIC_TXI);
+        pstcCtx->u16TxIdx += u16Size;
+    }
+    else
+    {
+        stcDmaChCfg.u32SrcAddr = (uint32_t)&M0P_I2C->DRR;
+        stcDmaChCfg.u32SrcInc = DMA_SRCADDRINC_FIX;
+        stcDmaChCfg.u32DesAddr = (uint32_t)&pstcCtx->stcXfer.pu8RxBuf[pstcCtx->u16RxIdx];
+        stcDmaChCfg.u32DesInc = DMA_DESADDRINC_INC;
+        DMA_ChannelCfg(pstcCtx->u8DmaCh, &stcDmaChCfg);
+        DMA_SetTriggerSrc(pstcCtx->u8DmaCh, EVT_IIC_RXI);
+        pstcCtx->u16RxIdx += u16Size;
+    }
+
+    DMA_ClearCplFlag(pstcCtx->u8DmaCh, DMA_FLAG_TC);
+    DMA_CplIrqCmd(pstcCtx->u8DmaCh, DMA_IRQ_TC, Enable);
+    DMA_ChannelEnable(pstcCtx->u8DmaCh);
+#else
+    (void)u8Dir;
+    (void)u16Size;
+#endif /* DDL_DMA_ENABLE */
+}
+
+/**
+ * @brief  Stop the DMA channel of the data phase.
+ * @param  None
+ * @retval None
+ */
+static void I2cMasterDmaStop(void)
+{
+#if (DDL_DMA_ENABLE == DDL_ON)
+    if (0u != m_stcI2cMaster.u8DmaEn)
+    {
+        DMA_ChannelDisable(m_stcI2cMaster.u8DmaCh);
+        DMA_CplIrqCmd(m_stcI2cMaster.u8DmaCh, DMA_IRQ_TC, Disable);
+        DMA_ClearCplFlag(m_stcI2cMaster.u8DmaCh, DMA_FLAG_TC);
+    }
+#endif /* DDL_DMA_ENABLE */
+}
+
+/**
+ * @brief  Complete the write phase of the slave engine and call the write callback.
+ * @param  None
+ * @retval None
+ */
+static void I2cSlaveWriteDone(void)
+{
+    stc_i2c_slave_ctx_t *pstcCtx = &m_stcI2cSlave;
+
+    if ((NULL != pstcCtx->pstcMap) && (0u != pstcCtx->u16WrCnt))
+    {
+        if (NULL != pstcCtx->pstcMap->pfnWrite)
+        {
+            pstcCtx->pstcMap->pfnWrite(pstcCtx->u8WrReg, pstcCtx->u16WrCnt);
+        }
+    }
+    pstcCtx->u16WrCnt = 0u;
+}
+
+/**
+ * @brief  Get the register at the pointer of the slave engine and increase the pointer.
+ * @param  None
+ * @retval Value of the register
+ */
+static uint8_t I2cSlaveReadNext(void)
+{
+    stc_i2c_slave_ctx_t *pstcCtx = &m_stcI2cSlave;
+    uint8_t u8Data = pstcCtx->pstcMap->pu8Reg[*pstcCtx->pu16Ptr];
+
+    (*pstcCtx->pu16Ptr)++;
+    if (*pstcCtx->pu16Ptr >= pstcCtx->pstcMap->u16RegNum)
+    {
+        *pstcCtx->pu16Ptr = 0u;
+    }
+
+    return u8Data;
+}
+
+/**
+ * @brief  Start an I2C master transaction with SMBus options.
+ * @param  [in] pstcXfer             Pointer to the transaction @ref stc_i2c_master_xfer_t
+ * @param  [in] u32Timeout           Transaction timeout in ticks of I2C_MasterTimeoutTick()
+ * @param  [in] pfnCplt              Transaction complete callback
+ * @param  [in] u8SmbOpt             0 or combination of I2C_SMBUS_OPT_PEC and I2C_SMBUS_OPT_BLOCK_RD
+ * @retval An en_result_t enumeration value, see I2C_MasterXferStart()
+ */
+static en_result_t I2cMasterXferStart(const stc_i2c_master_xfer_t *pstcXfer,
+                                      uint32_t u32Timeout,
+                                      func_ptr_i2c_cplt_t pfnCplt,
+                                      uint8_t u8SmbOpt)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if ((NULL != pstcXfer) &&                                                  \
+        ((NULL != pstcXfer->pu8TxBuf) || (0u == pstcXfer->u16TxLen)) &&        \
+        ((NULL != pstcXfer->pu8RxBuf) || (0u == pstcXfer->u16RxLen)))
+    {
+        DDL_ASSERT(IS_VALID_7BIT_ADR(pstcXfer->u8SlaveAdr));
+
+        if (I2C_MASTER_STATE_IDLE != m_stcI2cMaster.u8State)
+        {
+            enRet = ErrorOperationInProgress;
+        }
+        else if (0u != READ_REG32_BIT(M0P_I2C->SR, I2C_SR_BUSY))
+        {
+            enRet = ErrorNotReady;
+        }
+        else
+        {
+            m_stcI2cMaster.stcXfer = *pstcXfer;
+            m_stcI2cMaster.pfnCplt = pfnCplt;
+            m_stcI2cMaster.u16TxIdx = 0u;
+            m_stcI2cMaster.u16RxIdx = 0u;
+            m_stcI2cMaster.u32TimeoutCnt = u32Timeout;
+            m_stcI2cMaster.enResult = ErrorOperationInProgress;
+            m_stcI2cMaster.pstcJob = NULL;
+            m_stcI2cMaster.u16JobRemain = 0u;
+            m_stcI2cMaster.enBatchResult = Ok;
+            m_stcI2cMaster.u8RegLen = 0u;
+            m_stcI2cMaster.u8PecEn = (0u != (u8SmbOpt & I2C_SMBUS_OPT_PEC)) ? 1u : 0u;
+            m_stcI2cMaster.u8BlockRd = (0u != (u8SmbOpt & I2C_SMBUS_OPT_BLOCK_RD)) ? 1u : 0u;
+            m_stcI2cMaster.u8SmbErr = 0u;
+            m_stcI2cMaster.u8FastAck = (uint8_t)bM0P_I2C->CR1_b.FACKEN;
+
+            I2cMasterKick();
+            enRet = Ok;
+        }
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Get the length of the write phase, including the register address
+ *         and the PEC of the write only transaction.
+ * @param  None
+ * @retval Length of the write phase
+ */
+static uint32_t I2cMasterTxTotal(void)
+{
+    uint32_t u32Total = (uint32_t)m_stcI2cMaster.u8RegLen + m_stcI2cMaster.stcXfer.u16TxLen;
+
+    if ((0u != m_stcI2cMaster.u8PecEn) && (0u == m_stcI2cMaster.stcXfer.u16RxLen))
+    {
+        u32Total++;
+    }
+
+    return u32Total;
+}
+
+/**
+ * @brief  Get the length of the read phase, including the PEC.
+ * @param  None
+ * @retval Length of the read phase
+ */
+static uint32_t I2cMasterRxTotal(void)
+{
+    uint32_t u32Total = m_stcI2cMaster.stcXfer.u16RxLen;
+
+    if ((0u != m_stcI2cMaster.u8PecEn) && (0u != u32Total))
+    {
+        u32Total++;
+    }
+
+    return u32Total;
+}
+
+/**
+ * @brief  Convert the time in us to the count of the CPU wait loop.
+ * @param  [in] u32Us                Time in us
+ * @retval Count of the loop, about 10 CPU cycles each as DDL_Delay1ms()
+ */
+static uint32_t I2cBusUsToLoop(uint32_t u32Us)
+{
+    return ((SystemCoreClock / 1000000ul) * u32Us) / 10ul;
+}
+
+/**
+ * @brief  Wait for the bus recovery timing.
+ * @param  [in] u32Us                Time in us
+ * @retval None
+ */
+static void I2cBusDelayUs(uint32_t u32Us)
+{
+    __IO uint32_t u32Loop = I2cBusUsToLoop(u32Us) + 1ul;
+
+    while (u32Loop-- > 0ul)
+    {
+        ;
+    }
+}
+
+/**
+ * @brief  Update the SMBus PEC with one byte.
+ * @param  [in] u8Crc                CRC-8 of the previous bytes
+ * @param  [in] u8Data               Byte moved on the bus
+ * @retval CRC-8 including u8Data
+ */
+static uint8_t I2cSmbusCrc8(uint8_t u8Crc, uint8_t u8Data)
+{
+    u8Crc ^= u8Data;
+    u8Crc = (uint8_t)(u8Crc << 4u) ^ m_au8SmbusCrc8Nibble[u8Crc >> 4u];
+    u8Crc = (uint8_t)(u8Crc << 4u) ^ m_au8SmbusCrc8Nibble[u8Crc >> 4u];
+
+    return u8Crc;
+}
+
 /**
  * @}
  */
@@ -85,6 +85,16 @@
 /* Delay count for time out */
 #define TIMER0_TMOUT 0x2000ul
 
+/* Software timer wheel: 6 levels of 16 slots cover 2^24 ticks */
+#define TIMER0_SWT_LEVEL_NUM    (6u)
+#define TIMER0_SWT_SLOT_BITS    (4ul)
+#define TIMER0_SWT_SLOT_NUM     (16ul)
+#define TIMER0_SWT_SLOT_MASK    (TIMER0_SWT_SLOT_NUM - 1ul)
+/* No timer pending */
+#define TIMER0_SWT_NONE         (0xFFFFFFFFul)
+/* Minimum compare distance ahead of the running counter */
+#define TIMER0_SWT_MARGIN       (2ul)
+
 /**
  * @defgroup TIMER0_Check_Parameters_Validity TIMER0 Check Parameters Validity
  * @{
@@ -137,6 +147,14 @@
 /*******************************************************************************
  * Local variable definitions ('static')
  ******************************************************************************/
+/* Slot lists of the software timer wheel */
+static stc_timer0_swt_t *m_apstcSwtWheel[TIMER0_SWT_LEVEL_NUM][TIMER0_SWT_SLOT_NUM];
+/* Wheel time in ticks, the counter is cleared at this time */
+static uint32_t m_u32SwtBase = 0ul;
+/* Compare value armed since m_u32SwtBase */
+static uint16_t m_u16SwtArmed = 0u;
+static uint8_t m_u8SwtRun = 0u;
+static uint8_t m_u8SwtInIrq = 0u;
 
 /*******************************************************************************
  * Function implementation - global ('extern') and local ('static')
@@ -177,6 +195,256 @@ static void AsyncDelay(void)
     }
 }
 
+/**
+ * @brief  Link a software timer into the wheel slot of its expiry
+ * @param  [in] pstcTimer    Software timer with u32Expire set
+ *
+ * @retval Ticks from the wheel time until the slot is processed
+ */
+static uint32_t Timer0SwtLink(stc_timer0_swt_t *pstcTimer)
+{
+    uint32_t u32Idx = pstcTimer->u32Expire - m_u32SwtBase;
+    uint32_t u32Shift = 0ul;
+    stc_timer0_swt_t **ppstcHead;
+    uint32_t u32Level = 0ul;
+
+    while((u32Level < (TIMER0_SWT_LEVEL_NUM - 1u)) &&
+          (u32Idx >= (1ul << (u32Shift + TIMER0_SWT_SLOT_BITS))))
+    {
+        u32Level++;
+        u32Shift += TIMER0_SWT_SLOT_BITS;
+    }
+
+    ppstcHead = &m_apstcSwtWheel[u32Level][(pstcTimer->u32Expire >> u32Shift) & TIMER0_SWT_SLOT_MASK];
+    pstcTimer->pstcNext = *ppstcHead;
+    if(NULL != pstcTimer->pstcNext)
+    {
+        pstcTimer->pstcNext->ppstcPrev = &pstcTimer->pstcNext;
+    }
+    pstcTimer->ppstcPrev = ppstcHead;
+    *ppstcHead = pstcTimer;
+
+    /* Higher levels are cascaded when the lower bits of the time wrap */
+    return (pstcTimer->u32Expire & ~((1ul << u32Shift) - 1ul)) - m_u32SwtBase;
+}
+
+/**
+ * @brief  Unlink a pending software timer
+ * @param  [in] pstcTimer    Software timer
+ *
+ * @retval None
+ */
+static void Timer0SwtUnlink(stc_timer0_swt_t *pstcTimer)
+{
+    *pstcTimer->ppstcPrev = pstcTimer->pstcNext;
+    if(NULL != pstcTimer->pstcNext)
+    {
+        pstcTimer->pstcNext->ppstcPrev = pstcTimer->ppstcPrev;
+    }
+    pstcTimer->ppstcPrev = NULL;
+}
+
+/**
+ * @brief  Ticks from the wheel time to the next slot holding timers
+ * @param  None
+ *
+ * @retval Ticks, or TIMER0_SWT_NONE when no timer is pending
+ */
+static uint32_t Timer0SwtNextDelta(void)
+{
+    uint32_t u32Level;
+    uint32_t u32Shift;
+    uint32_t u32Offset;
+    uint32_t u32Delta;
+    uint32_t k;
+    uint32_t u32Min = TIMER0_SWT_NONE;
+
+    for(u32Level = 0ul; u32Level < TIMER0_SWT_LEVEL_NUM; u32Level++)
+    {
+        u32Shift = u32Level * TIMER0_SWT_SLOT_BITS;
+        u32Offset = m_u32SwtBase & ((1ul << u32Shift) - 1ul);
+        for(k = 1ul; k <= TIMER0_SWT_SLOT_NUM; k++)
+        {
+            u32Delta = (k << u32Shift) - u32Offset;
+            if(u32Delta >= u32Min)
+            {
+                break;
+            }
+            if(NULL != m_apstcSwtWheel[u32Level][((m_u32SwtBase >> u32Shift) + k) & TIMER0_SWT_SLOT_MASK])
+            {
+                u32Min = u32Delta;
+                break;
+            }
+        }
+    }
+
+    return u32Min;
+}
+
+/**
+ * @brief  Cascade the slots due at the wheel time and run expired timers
+ * @param  None
+ *
+ * @retval None
+ */
+static void Timer0SwtRunTick(void)
+{
+    stc_timer0_swt_t *pstcList;
+    stc_timer0_swt_t *pstcTimer;
+    stc_timer0_swt_t **ppstcHead;
+    uint32_t u32Level;
+    uint32_t u32Shift;
+
+    /* Re-distribute a higher level slot each time the level below wraps */
+    for(u32Level = 1ul; u32Level < TIMER0_SWT_LEVEL_NUM; u32Level++)
+    {
+        u32Shift = u32Level * TIMER0_SWT_SLOT_BITS;
+        if(0ul != (m_u32SwtBase & ((1ul << u32Shift) - 1ul)))
+        {
+            break;
+        }
+        ppstcHead = &m_apstcSwtWheel[u32Level][(m_u32SwtBase >> u32Shift) & TIMER0_SWT_SLOT_MASK];
+        pstcList = *ppstcHead;
+        *ppstcHead = NULL;
+        while(NULL != pstcList)
+        {
+            pstcTimer = pstcList;
+            pstcList = pstcList->pstcNext;
+            (void)Timer0SwtLink(pstcTimer);
+        }
+    }
+
+    /* Detach the expired slot, callbacks may stop timers still in it */
+    ppstcHead = &m_apstcSwtWheel[0u][m_u32SwtBase & TIMER0_SWT_SLOT_MASK];
+    pstcList = *ppstcHead;
+    *ppstcHead = NULL;
+    if(NULL != pstcList)
+    {
+        pstcList->ppstcPrev = &pstcList;
+    }
+    while(NULL != pstcList)
+    {
+        pstcTimer = pstcList;
+        Timer0SwtUnlink(pstcTimer);
+        if(0ul != pstcTimer->u32Period)
+        {
+            pstcTimer->u32Expire += pstcTimer->u32Period;
+            (void)Timer0SwtLink(pstcTimer);
+        }
+        if(NULL != pstcTimer->pfnCallback)
+        {
+            pstcTimer->pfnCallback();
+        }
+    }
+}
+
+/**
+ * @brief  Advance the wheel time, stopping at every slot holding timers
+ * @param  [in] u32Ticks    Ticks elapsed
+ *
+ * @retval None
+ */
+static void Timer0SwtAdvance(uint32_t u32Ticks)
+{
+    uint32_t u32Delta;
+
+    while(0ul != u32Ticks)
+    {
+        u32Delta = Timer0SwtNextDelta();
+        if(u32Delta > u32Ticks)
+        {
+            m_u32SwtBase += u32Ticks;
+            u32Ticks = 0ul;
+        }
+        else
+        {
+            m_u32SwtBase += u32Delta;
+            u32Ticks -= u32Delta;
+            Timer0SwtRunTick();
+        }
+    }
+}
+
+/**
+ * @brief  Current time in ticks
+ * @param  None
+ *
+ * @retval Wheel time plus the running count, the wheel time in the handler
+ */
+static uint32_t Timer0SwtNow(void)
+{
+    uint32_t u32Now = m_u32SwtBase;
+    uint16_t u16Cnt;
+
+    if((0u != m_u8SwtRun) && (0u == m_u8SwtInIrq))
+    {
+        u16Cnt = TIMER0_GetCntReg();
+        if(Set == TIMER0_GetFlag())
+        {
+            /* Matched but not handled yet, the counter restarted from 0 */
+            u32Now += m_u16SwtArmed;
+            u16Cnt = TIMER0_GetCntReg();
+        }
+        u32Now += u16Cnt;
+    }
+
+    return u32Now;
+}
+
+/**
+ * @brief  Program the compare match of the next slot holding timers
+ * @param  None
+ *
+ * @retval None
+ */
+static void Timer0SwtArm(void)
+{
+    uint32_t u32Delta = Timer0SwtNextDelta();
+    uint16_t u16Target;
+    uint16_t u16Cnt;
+
+    if(TIMER0_SWT_NONE == u32Delta)
+    {
+        /* Nothing pending, no interrupt until the next start */
+        if(0u != m_u8SwtRun)
+        {
+            m_u32SwtBase = Timer0SwtNow();
+            (void)TIMER0_Cmd(Disable);
+            (void)TIMER0_ClearFlag();
+            m_u8SwtRun = 0u;
+        }
+    }
+    else
+    {
+        u16Target = (u32Delta > 0xFFFFul) ? 0xFFFFu : (uint16_t)u32Delta;
+        if(0u == m_u8SwtRun)
+        {
+            (void)TIMER0_WriteCntReg(0u);
+            (void)TIMER0_WriteCmpReg(u16Target);
+            (void)TIMER0_ClearFlag();
+            (void)TIMER0_Cmd(Enable);
+            m_u16SwtArmed = u16Target;
+            m_u8SwtRun = 1u;
+        }
+        else if(Reset == TIMER0_GetFlag())
+        {
+            u16Cnt = TIMER0_GetCntReg();
+            if((uint32_t)u16Target < ((uint32_t)u16Cnt + TIMER0_SWT_MARGIN))
+            {
+                /* Too late for the exact tick, fire as soon as possible */
+                u16Target = (((uint32_t)u16Cnt + TIMER0_SWT_MARGIN) > 0xFFFFul) ?
+                            m_u16SwtArmed : (uint16_t)(u16Cnt + TIMER0_SWT_MARGIN);
+            }
+            (void)TIMER0_WriteCmpReg(u16Target);
+            m_u16SwtArmed = u16Target;
+        }
+        else
+        {
+            /* A match is pending, TIMER0_SWT_IrqHandler() re-arms */
+        }
+    }
+}
+
 /**
  * @}
  */
@@ -487,6 +755,153 @@ void TIMER0_SetTriggerSrc(en_event_src_t enEvent)
     M0P_AOS->TMR0_HTSSR_f.TRGSEL = enEvent;  
 }
 
+/**
+ * @brief  Initialize the software timer wheel driven by Timer0 compare match
+ * @param  None
+ *
+ * @retval Ok: Success
+ * @retval ErrorTimeout: Process timeout
+ * @note   Timer0 is configured beforehand by TIMER0_Init() in compare mode
+ *         with TIMER0_CLK_SRC_HCLK; one count of Timer0 is one tick. The
+ *         compare interrupt is registered by the application, which calls
+ *         TIMER0_SWT_IrqHandler() from its callback.
+ * @note   Timer0 is reprogrammed to the next expiry as a one-shot and is
+ *         stopped while no timer is pending, so idle time costs no
+ *         interrupt. Choose a count clock division of 4 or more so that
+ *         reprogramming completes within TIMER0_SWT_MARGIN ticks.
+ */
+en_result_t TIMER0_SWT_Init(void)
+{
+    en_result_t enRet;
+    uint32_t i;
+    uint32_t j;
+
+    for(i = 0ul; i < TIMER0_SWT_LEVEL_NUM; i++)
+    {
+        for(j = 0ul; j < TIMER0_SWT_SLOT_NUM; j++)
+        {
+            m_apstcSwtWheel[i][j] = NULL;
+        }
+    }
+    m_u32SwtBase = 0ul;
+    m_u16SwtArmed = 0u;
+    m_u8SwtRun = 0u;
+    m_u8SwtInIrq = 0u;
+
+    enRet = TIMER0_Cmd(Disable);
+    if(Ok == enRet)
+    {
+        enRet = TIMER0_ClearFlag();
+    }
+    if(Ok == enRet)
+    {
+        enRet = TIMER0_IntCmd(Enable);
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Start or restart a software timer
+ * @param  [in] pstcTimer    Software timer, zero-initialized before its first use,
+ *                           with u32Period and pfnCallback set
+ * @param  [in] u32Delay     Ticks until the first expiry, 1-TIMER0_SWT_TICK_MAX
+ *
+ * @retval Ok: Success
+ * @retval ErrorInvalidParameter: Parameter error
+ * @note   Insertion is O(1). Timer0 is only reprogrammed when the new timer
+ *         is due before the armed compare match. Called from a callback,
+ *         the delay counts from the expiry being handled.
+ */
+en_result_t TIMER0_SWT_Start(stc_timer0_swt_t *pstcTimer, uint32_t u32Delay)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+    uint32_t u32Primask;
+    uint32_t u32Due;
+
+    if((NULL != pstcTimer) && (0ul != u32Delay) &&
+       (u32Delay <= TIMER0_SWT_TICK_MAX) && (pstcTimer->u32Period <= TIMER0_SWT_TICK_MAX))
+    {
+        u32Primask = __get_PRIMASK();
+        __disable_irq();
+
+        if(NULL != pstcTimer->ppstcPrev)
+        {
+            Timer0SwtUnlink(pstcTimer);
+        }
+        pstcTimer->u32Expire = Timer0SwtNow() + u32Delay;
+        u32Due = Timer0SwtLink(pstcTimer);
+
+        if((0u == m_u8SwtInIrq) &&
+           ((0u == m_u8SwtRun) || (u32Due < (uint32_t)m_u16SwtArmed)))
+        {
+            Timer0SwtArm();
+        }
+
+        __set_PRIMASK(u32Primask);
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Stop a software timer
+ * @param  [in] pstcTimer    Software timer
+ *
+ * @retval None
+ * @note   Removal is O(1). The armed compare match is left as is and
+ *         re-arms to the next timer when it fires.
+ */
+void TIMER0_SWT_Stop(stc_timer0_swt_t *pstcTimer)
+{
+    uint32_t u32Primask;
+
+    DDL_ASSERT(NULL != pstcTimer);
+
+    u32Primask = __get_PRIMASK();
+    __disable_irq();
+    if(NULL != pstcTimer->ppstcPrev)
+    {
+        Timer0SwtUnlink(pstcTimer);
+    }
+    __set_PRIMASK(u32Primask);
+}
+
+/**
+ * @brief  Get the pending status of a software timer
+ * @param  [in] pstcTimer    Software timer
+ *
+ * @retval Set                   Timer is pending
+ *         Reset                 Timer is stopped or expired
+ */
+en_flag_status_t TIMER0_SWT_IsPending(const stc_timer0_swt_t *pstcTimer)
+{
+    DDL_ASSERT(NULL != pstcTimer);
+
+    return (NULL != pstcTimer->ppstcPrev) ? Set : Reset;
+}
+
+/**
+ * @brief  Timer0 compare match handler of the software timer wheel
+ * @param  None
+ *
+ * @retval None
+ * @note   Call from the Timer0 compare interrupt callback. Expired timers
+ *         call their pfnCallback from here.
+ */
+void TIMER0_SWT_IrqHandler(void)
+{
+    if(Set == TIMER0_GetFlag())
+    {
+        (void)TIMER0_ClearFlag();
+        m_u8SwtInIrq = 1u;
+        Timer0SwtAdvance(m_u16SwtArmed);
+        m_u8SwtInIrq = 0u;
+        Timer0SwtArm();
+    }
+}
+
 /**
  * @}
  */
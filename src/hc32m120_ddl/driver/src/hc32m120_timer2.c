@@ -55,6 +55,8 @@
  * Include files
  ******************************************************************************/
 #include "hc32m120_timer2.h"
+#include "hc32m120_pwc.h"
+#include "hc32m120_interrupts.h"
 #include "hc32m120_utility.h"
 
 /**
@@ -122,6 +124,15 @@
  */
 #define TIMER2_CLK_CFG_MSK                  (TMR2_BCONR_SYNSA | TMR2_BCONR_CKDIVA | TMR2_BCONR_SYNCLKA | TMR2_BCONR_ASYNCLKA)
 
+/**
+ * @brief TIMER2 wake-up scheduler definitions.
+ * @note  A TIMER2 register write needs at least 3 asynchronous clock cycles before the next one.
+ */
+#define TIMER2_WAKE_SYNC_CYCLES             (4ul)
+#define TIMER2_WAKE_CMP_MAX                 (0xFFFFul)
+/* Shortest chained compare period: the next CMPAR write must land before the counter reaches it. */
+#define TIMER2_WAKE_SEG_MIN                 (2ul * TIMER2_WAKE_SYNC_CYCLES)
+
 /**
  * @defgroup TIMER2_Check_Parameters_Validity TIMER2 check parameters validity
  * @{
@@ -147,6 +158,14 @@
     ((x) == TIMER2_CLK_PRESCALER_512)       ||                                 \
     ((x) == TIMER2_CLK_PRESCALER_1024))
 
+#define IS_TIMER2_WAKE_CLK_SOURCE(x)                                           \
+(   ((x) == TIMER2_ASYNC_CS_LRC)            ||                                 \
+    ((x) == TIMER2_ASYNC_CS_CLKA))
+
+#define IS_TIMER2_WAKE_CLK_FREQ(x)                                             \
+(   ((x) != 0ul)                            &&                                 \
+    ((x) <= TIMER2_WAKE_CLK_FREQ_MAX))
+
 #define IS_TIMER2_FILTER_PRESCALER(x)                                          \
 (   ((x) == TIMER2_FILTER_PRESCALER_1)      ||                                 \
     ((x) == TIMER2_FILTER_PRESCALER_4)      ||                                 \
@@ -260,10 +279,40 @@
 /*******************************************************************************
  * Local function prototypes ('static')
  ******************************************************************************/
+/**
+ * @addtogroup TIMER2_Local_Functions
+ * @{
+ */
+static void Timer2WakeAsyncDelay(void);
+static uint32_t Timer2WakeSegment(uint32_t u32Ticks, uint32_t u32Max);
+#if (DDL_UTILITY_ENABLE == DDL_ON)
+static uint16_t Timer2WakeReadCnt(void);
+#endif /* DDL_UTILITY_ENABLE */
+/**
+ * @}
+ */
 
 /*******************************************************************************
  * Local variable definitions ('static')
  ******************************************************************************/
+/**
+ * @defgroup TIMER2_Local_Variables TIMER2 Local Variables
+ * @{
+ */
+/* Nominal asynchronous clock frequency(Hz), 0 while the scheduler is not initialized. */
+static uint32_t m_u32WakeNomFreq = 0ul;
+/* Compensated asynchronous clock frequency(mHz). */
+static uint32_t m_u32WakeClkFreq = 0ul;
+static int32_t m_i32WakePpm = 0l;
+static uint32_t m_u32WakePscShift = 0ul;
+/* Ticks still to be counted after the segment currently loaded. */
+static __IO uint32_t m_u32WakeRemain = 0ul;
+static __IO uint8_t m_u8WakeExpired = 0u;
+/* A wake-up is being counted, the match interrupt is ignored otherwise. */
+static __IO uint8_t m_u8WakeRun = 0u;
+/**
+ * @}
+ */
 
 /*******************************************************************************
  * Function implementation - global ('extern') and local ('static')
@@ -576,6 +625,447 @@ void TIMER2_ClrFlag(uint16_t u16Flag)
     M0P_TMR2->STFLR &= ~((uint32_t)u16Flag);
 }
 
+/**
+ * @brief  Set a default value for TIMER2 wake-up scheduler initialization structure.
+ * @param  [in]  pstcInit           Pointer to a stc_timer2_wake_init_t structure that
+ *                                  contains configuration information.
+ * @retval An en_result_t enumeration value.
+ *   @arg  Ok:                      No errors occurred.
+ *   @arg  ErrorInvalidParameter:   pstcInit == NULL.
+ */
+en_result_t TIMER2_WAKE_StructInit(stc_timer2_wake_init_t *pstcInit)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if (pstcInit != NULL)
+    {
+        pstcInit->u16ClkSource    = TIMER2_ASYNC_CS_LRC;
+        pstcInit->u16ClkPrescaler = TIMER2_CLK_PRESCALER_1;
+        pstcInit->u32ClkFreq      = LRC_VALUE;
+
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Configures TIMER2 as a wake-up scheduler counting the asynchronous clock.
+ *         The counter match interrupt is enabled and selected as a wake-up source of stop mode.
+ * @param  [in]  pstcInit           Pointer to a stc_timer2_wake_init_t structure value that
+ *                                  contains the configuration information for the scheduler.
+ * @retval An en_result_t enumeration value.
+ *   @arg  Ok:                      No errors occurred.
+ *   @arg  ErrorInvalidParameter:  -pstcInit == NULL.
+ *                                 -The nominal clock frequency is 0 or above TIMER2_WAKE_CLK_FREQ_MAX.
+ * @note   The TIMER2 peripheral clock and the asynchronous clock(LRC or pin CLKA) must be
+ *         enabled by the application, and INT_TMR2_GCMP must be registered with a handler
+ *         that calls TIMER2_WAKE_IrqHandler(). The clock error compensation is reset to 0ppm.
+ */
+en_result_t TIMER2_WAKE_Init(const stc_timer2_wake_init_t *pstcInit)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if (pstcInit != NULL)
+    {
+        DDL_ASSERT(IS_TIMER2_WAKE_CLK_SOURCE(pstcInit->u16ClkSource));
+        DDL_ASSERT(IS_TIMER2_CLK_PRESCALER(pstcInit->u16ClkPrescaler));
+
+        if (IS_TIMER2_WAKE_CLK_FREQ(pstcInit->u32ClkFreq))
+        {
+            m_u32WakeNomFreq  = pstcInit->u32ClkFreq;
+            m_u32WakePscShift = (uint32_t)pstcInit->u16ClkPrescaler >> TMR2_BCONR_CKDIVA_POS;
+            m_u32WakeRemain   = 0ul;
+            m_u8WakeExpired   = 0u;
+            m_u8WakeRun       = 0u;
+            (void)TIMER2_WAKE_SetCompensation(0l);
+
+            TIMER2_Stop();
+            Timer2WakeAsyncDelay();
+            M0P_TMR2->BCONR = (uint32_t)(pstcInit->u16ClkSource | pstcInit->u16ClkPrescaler);
+            Timer2WakeAsyncDelay();
+            M0P_TMR2->HCONR = (uint32_t)0x0;
+            Timer2WakeAsyncDelay();
+            M0P_TMR2->PCONR = (uint32_t)0x0;
+            Timer2WakeAsyncDelay();
+            M0P_TMR2->CMPAR = TIMER2_WAKE_CMP_MAX;
+            Timer2WakeAsyncDelay();
+            M0P_TMR2->CNTAR = (uint32_t)0x0;
+            Timer2WakeAsyncDelay();
+            M0P_TMR2->STFLR = (uint32_t)0x0;
+            Timer2WakeAsyncDelay();
+            M0P_TMR2->ICONR = (uint32_t)TMR2_ICONR_CMENA;
+            Timer2WakeAsyncDelay();
+
+#if (DDL_INTERRUPTS_ENABLE == DDL_ON)
+            /* Counter match of TIMER2 wakes the MCU up from stop mode. */
+            INTC_WakeupSrcCmd(INTC_WUPENR_TMR2CMPWUEN, Enable);
+#endif /* DDL_INTERRUPTS_ENABLE */
+
+            enRet = Ok;
+        }
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Set the clock error of the asynchronous clock used to convert wake-up times.
+ * @param  [in]  i32Ppm             Clock error in ppm, positive if the clock runs faster than nominal.
+ *                                  This parameter can be a value between -TIMER2_WAKE_PPM_MAX and TIMER2_WAKE_PPM_MAX.
+ * @retval An en_result_t enumeration value.
+ *   @arg  Ok:                      No errors occurred.
+ *   @arg  ErrorInvalidParameter:   i32Ppm is out of range.
+ *   @arg  ErrorNotReady:           The scheduler is not initialized.
+ * @note   The new compensation applies to the next call of TIMER2_WAKE_Start().
+ */
+en_result_t TIMER2_WAKE_SetCompensation(int32_t i32Ppm)
+{
+    en_result_t enRet = ErrorNotReady;
+
+    if (m_u32WakeNomFreq != 0ul)
+    {
+        enRet = ErrorInvalidParameter;
+        if ((i32Ppm >= -TIMER2_WAKE_PPM_MAX) && (i32Ppm <= TIMER2_WAKE_PPM_MAX))
+        {
+            m_i32WakePpm     = i32Ppm;
+            m_u32WakeClkFreq = (uint32_t)(((int64_t)m_u32WakeNomFreq * (1000000ll + (int64_t)i32Ppm)) / 1000ll);
+            enRet = Ok;
+        }
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Get the clock error compensation of the wake-up scheduler.
+ * @param  None
+ * @retval Clock error in ppm, positive if the clock runs faster than nominal.
+ */
+int32_t TIMER2_WAKE_GetCompensation(void)
+{
+    return m_i32WakePpm;
+}
+
+#if (DDL_UTILITY_ENABLE == DDL_ON)
+/**
+ * @brief  Measure the asynchronous clock against HCLK and update the clock error compensation.
+ * @param  [in]  u32HclkFreq        The frequency(Hz) of HCLK.
+ * @param  [in]  u16Ticks           Number of TIMER2 counter ticks to measure, 1 ~ TIMER2_WAKE_CAL_TICKS_MAX.
+ *                                  More ticks give a finer result at the cost of a longer busy wait.
+ * @retval An en_result_t enumeration value.
+ *   @arg  Ok:                      No errors occurred.
+ *   @arg  ErrorInvalidParameter:  -u32HclkFreq == 0 or u16Ticks is out of range.
+ *                                 -The measured clock error exceeds TIMER2_WAKE_PPM_MAX.
+ *   @arg  ErrorNotReady:           The scheduler is not initialized or TIMER2 is running.
+ *   @arg  ErrorTimeout:            The asynchronous clock is not counting.
+ * @note   The result is only as accurate as HCLK. Let the CTC trim HRC against XTAL or CTCREF
+ *         (CTC flag TRMOK set) before calling this function, and call SysTick_Init() first
+ *         since HCLK cycles are counted by SysTick_GetCycle().
+ */
+en_result_t TIMER2_WAKE_Calibrate(uint32_t u32HclkFreq, uint16_t u16Ticks)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+    uint64_t u64Start;
+    uint64_t u64Cycles;
+    uint64_t u64Timeout;
+    uint64_t u64Freq;
+    uint16_t u16Cnt;
+    uint16_t u16Base;
+
+    if ((u32HclkFreq != 0ul) && (u16Ticks != 0u) && (u16Ticks <= TIMER2_WAKE_CAL_TICKS_MAX))
+    {
+        enRet = ErrorNotReady;
+        if ((m_u32WakeNomFreq != 0ul) && (bM0P_TMR2->BCONR_b.CSTA == 0ul))
+        {
+            /* Budget twice the nominal duration of the measurement, plus the first edge. */
+            u64Timeout = ((((uint64_t)u16Ticks + 2ull) * (uint64_t)u32HclkFreq) << m_u32WakePscShift) / m_u32WakeNomFreq;
+            u64Timeout *= 2ull;
+
+            M0P_TMR2->CMPAR = TIMER2_WAKE_CMP_MAX;
+            Timer2WakeAsyncDelay();
+            M0P_TMR2->CNTAR = (uint32_t)0x0;
+            Timer2WakeAsyncDelay();
+            TIMER2_Start();
+
+            enRet = ErrorTimeout;
+            u64Start = SysTick_GetCycle();
+            /* Align to a counter edge. */
+            u16Base = Timer2WakeReadCnt();
+            do
+            {
+                u16Cnt = Timer2WakeReadCnt();
+            } while ((u16Cnt == u16Base) && ((SysTick_GetCycle() - u64Start) < u64Timeout));
+
+            if (u16Cnt != u16Base)
+            {
+                u16Base  = u16Cnt;
+                u64Start = SysTick_GetCycle();
+                do
+                {
+                    u16Cnt    = Timer2WakeReadCnt();
+                    u64Cycles = SysTick_GetCycle() - u64Start;
+                } while (((uint16_t)(u16Cnt - u16Base) < u16Ticks) && (u64Cycles < u64Timeout));
+
+                if ((uint16_t)(u16Cnt - u16Base) >= u16Ticks)
+                {
+                    /* Frequency of the clock source before the prescaler, in mHz. */
+                    u64Freq = (((uint64_t)u16Ticks * (uint64_t)u32HclkFreq * 1000ull) << m_u32WakePscShift) / u64Cycles;
+                    enRet = TIMER2_WAKE_SetCompensation((int32_t)((int64_t)((u64Freq * 1000ull) / m_u32WakeNomFreq) - 1000000ll));
+                }
+            }
+
+            TIMER2_Stop();
+            Timer2WakeAsyncDelay();
+            M0P_TMR2->CNTAR = (uint32_t)0x0;
+            Timer2WakeAsyncDelay();
+        }
+    }
+
+    return enRet;
+}
+#endif /* DDL_UTILITY_ENABLE */
+
+/**
+ * @brief  Convert a wake-up time into TIMER2 counter ticks with the clock error compensation applied.
+ * @param  [in]  u32TimeUs          Wake-up time in microseconds.
+ * @retval Number of counter ticks, rounded to the nearest tick. 0 if the scheduler is not initialized.
+ */
+uint32_t TIMER2_WAKE_TimeToTicks(uint32_t u32TimeUs)
+{
+    uint64_t u64Div;
+    uint64_t u64Ticks;
+
+    u64Div   = 1000000000ull << m_u32WakePscShift;
+    u64Ticks = ((uint64_t)u32TimeUs * (uint64_t)m_u32WakeClkFreq + (u64Div / 2ull)) / u64Div;
+    if (u64Ticks > 0xFFFFFFFFull)
+    {
+        u64Ticks = 0xFFFFFFFFull;
+    }
+
+    return (uint32_t)u64Ticks;
+}
+
+/**
+ * @brief  Schedule a wake-up after the specified time. A pending wake-up is replaced.
+ * @param  [in]  u32TimeUs          Wake-up time in microseconds.
+ * @retval An en_result_t enumeration value.
+ *   @arg  Ok:                      No errors occurred.
+ *   @arg  ErrorInvalidParameter:   The time is shorter than half a counter tick.
+ *   @arg  ErrorNotReady:           The scheduler is not initialized.
+ * @note   Times longer than 0xFFFF ticks are counted in several compare periods; each match
+ *         interrupt wakes the MCU up briefly to write the compare value of the next one while
+ *         the counter keeps running, so no tick is lost between the periods.
+ * @note   Use TIMER2_WAKE_EnterStopMode() to wait for the wake-up. A loop that tests
+ *         TIMER2_WAKE_IsExpired() and then calls PWC_EnterStopMode() loses the wake-up if the
+ *         match interrupt comes in between the test and WFI.
+ */
+en_result_t TIMER2_WAKE_Start(uint32_t u32TimeUs)
+{
+    en_result_t enRet = ErrorNotReady;
+    uint32_t u32Ticks;
+    uint32_t u32Seg;
+    uint32_t u32Primask;
+
+    if (m_u32WakeNomFreq != 0ul)
+    {
+        enRet = ErrorInvalidParameter;
+        u32Ticks = TIMER2_WAKE_TimeToTicks(u32TimeUs);
+        if (u32Ticks != 0ul)
+        {
+            u32Seg = Timer2WakeSegment(u32Ticks, TIMER2_WAKE_CMP_MAX);
+
+            u32Primask = __get_PRIMASK();
+            __disable_irq();
+            m_u8WakeRun     = 0u;
+            m_u8WakeExpired = 0u;
+            TIMER2_Stop();
+            __set_PRIMASK(u32Primask);
+
+            Timer2WakeAsyncDelay();
+            M0P_TMR2->CNTAR = (uint32_t)0x0;
+            Timer2WakeAsyncDelay();
+            M0P_TMR2->CMPAR = u32Seg;
+            Timer2WakeAsyncDelay();
+            M0P_TMR2->STFLR = (uint32_t)0x0;
+            Timer2WakeAsyncDelay();
+
+            u32Primask = __get_PRIMASK();
+            __disable_irq();
+            m_u32WakeRemain = u32Ticks - u32Seg;
+            m_u8WakeRun     = 1u;
+            TIMER2_Start();
+            __set_PRIMASK(u32Primask);
+
+            enRet = Ok;
+        }
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Cancel the pending wake-up and stop TIMER2.
+ * @param  None
+ * @retval None
+ */
+void TIMER2_WAKE_Stop(void)
+{
+    uint32_t u32Primask;
+
+    u32Primask = __get_PRIMASK();
+    __disable_irq();
+    m_u8WakeRun     = 0u;
+    m_u32WakeRemain = 0ul;
+    TIMER2_Stop();
+    M0P_TMR2->STFLR = (uint32_t)0x0;
+    __set_PRIMASK(u32Primask);
+}
+
+/**
+ * @brief  Get the state of the scheduled wake-up.
+ * @param  None
+ * @retval An en_flag_status_t enumeration.
+ *   @arg  Set: The wake-up time has elapsed.
+ *   @arg  Reset: No wake-up has elapsed since the last TIMER2_WAKE_Start().
+ */
+en_flag_status_t TIMER2_WAKE_IsExpired(void)
+{
+    return (m_u8WakeExpired != 0u) ? Set : Reset;
+}
+
+#if (DDL_PWC_ENABLE == DDL_ON)
+/**
+ * @brief  Enter stop mode unless the scheduled wake-up has already elapsed.
+ * @param  None
+ * @retval An en_flag_status_t enumeration.
+ *   @arg  Set: The wake-up time has elapsed.
+ *   @arg  Reset: Woken up by another interrupt or by a chained compare period.
+ * @note   The test and WFI run with PRIMASK set, a match interrupt arriving in between stays
+ *         pending and makes WFI return at once. The interrupt is taken when PRIMASK is
+ *         restored. Wait for the wake-up with:
+ *         while (TIMER2_WAKE_EnterStopMode() == Reset) { ; }
+ */
+en_flag_status_t TIMER2_WAKE_EnterStopMode(void)
+{
+    uint32_t u32Primask;
+
+    u32Primask = __get_PRIMASK();
+    __disable_irq();
+    if (m_u8WakeExpired == 0u)
+    {
+        PWC_EnterStopMode();
+    }
+    __set_PRIMASK(u32Primask);
+
+    return (m_u8WakeExpired != 0u) ? Set : Reset;
+}
+#endif /* DDL_PWC_ENABLE */
+
+/**
+ * @brief  TIMER2 wake-up scheduler interrupt handler.
+ *         Call it from the INT_TMR2_GCMP handler of the application.
+ * @param  None
+ * @retval None
+ * @note   The counter clears on the tick after a match and keeps counting, so a chained
+ *         compare period of N ticks is loaded as CMPAR = N - 1.
+ */
+void TIMER2_WAKE_IrqHandler(void)
+{
+    uint32_t u32Seg;
+
+    if ((M0P_TMR2->STFLR & (uint32_t)TIMER2_FLAG_CNT_MATCH) != 0ul)
+    {
+        M0P_TMR2->STFLR &= ~((uint32_t)TIMER2_FLAG_CNT_MATCH);
+        if (m_u8WakeRun != 0u)
+        {
+            if (m_u32WakeRemain != 0ul)
+            {
+                u32Seg = Timer2WakeSegment(m_u32WakeRemain, TIMER2_WAKE_CMP_MAX + 1ul);
+                m_u32WakeRemain -= u32Seg;
+                M0P_TMR2->CMPAR = u32Seg - 1ul;
+            }
+            else
+            {
+                TIMER2_Stop();
+                m_u8WakeRun     = 0u;
+                m_u8WakeExpired = 1u;
+            }
+        }
+    }
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup TIMER2_Local_Functions TIMER2 Local Functions
+ * @{
+ */
+
+/**
+ * @brief  Wait for TIMER2 to take a register write in the asynchronous clock domain.
+ * @param  None
+ * @retval None
+ */
+static void Timer2WakeAsyncDelay(void)
+{
+    uint32_t i;
+    uint32_t u32Cnt;
+
+    if (m_u32WakeNomFreq != 0ul)
+    {
+        u32Cnt = (SystemCoreClock / m_u32WakeNomFreq + 1ul) * TIMER2_WAKE_SYNC_CYCLES;
+        for (i = 0ul; i < u32Cnt; i++)
+        {
+            __NOP();
+        }
+    }
+}
+
+/**
+ * @brief  Split the next compare period off the ticks left until the wake-up.
+ * @param  [in]  u32Ticks           Ticks left until the wake-up.
+ * @param  [in]  u32Max             Longest compare period.
+ * @retval Ticks of the next compare period. The ticks left after it are either 0 or at
+ *         least TIMER2_WAKE_SEG_MIN.
+ */
+static uint32_t Timer2WakeSegment(uint32_t u32Ticks, uint32_t u32Max)
+{
+    uint32_t u32Seg = u32Ticks;
+
+    if (u32Seg > u32Max)
+    {
+        u32Seg = u32Max;
+        if ((u32Ticks - u32Seg) < TIMER2_WAKE_SEG_MIN)
+        {
+            u32Seg = u32Ticks - TIMER2_WAKE_SEG_MIN;
+        }
+    }
+
+    return u32Seg;
+}
+
+#if (DDL_UTILITY_ENABLE == DDL_ON)
+/**
+ * @brief  Read the counter of TIMER2 running in the asynchronous clock domain.
+ * @param  None
+ * @retval Counter value, read twice until stable.
+ */
+static uint16_t Timer2WakeReadCnt(void)
+{
+    uint16_t u16Cnt;
+
+    do
+    {
+        u16Cnt = (uint16_t)M0P_TMR2->CNTAR;
+    } while (u16Cnt != (uint16_t)M0P_TMR2->CNTAR);
+
+    return u16Cnt;
+}
+#endif /* DDL_UTILITY_ENABLE */
+
 /**
  * @}
  */
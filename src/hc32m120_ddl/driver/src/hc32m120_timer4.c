@@ -76,6 +76,26 @@
 /*******************************************************************************
  * Local type definitions ('typedef')
  ******************************************************************************/
+/**
+ * @defgroup TIMER4_Local_Types TIMER4 Local Types
+ * @{
+ */
+
+/**
+ * @brief Timer4 scheduler task.
+ */
+typedef struct
+{
+    func_ptr_timer4_sched_t pfnTask;    /*!< Task callback. */
+    uint16_t u16Divisor;                /*!< Task period in PWM periods. */
+    uint16_t u16Ratio;                  /*!< Slot interrupts per task run. */
+    uint16_t u16Cnt;                    /*!< Slot interrupts since the last run. */
+    uint8_t  u8Slot;                    /*!< TIMER4_SCHED_SLOT_ZERO or TIMER4_SCHED_SLOT_PEAK. */
+} stc_timer4_sched_task_t;
+
+/**
+ * @}
+ */
 
 /*******************************************************************************
  * Local pre-processor symbols/macros ('#define')
@@ -293,6 +313,28 @@
  * @}
  */
 
+/**
+ * @defgroup TIMER4_INV_Constant TIMER4 Inverter Constant
+ * @{
+ */
+#define TIMER4_INV_DUTY_FULL                (32768L)    /*!< 100% duty in Q15 */
+#define TIMER4_INV_SQRT3_DIV2               (28378L)    /*!< sqrt(3)/2 in Q15 */
+/**
+ * @}
+ */
+
+/**
+ * @defgroup TIMER4_SCHED_Constant TIMER4 Scheduler Constant
+ * @{
+ */
+#define TIMER4_SCHED_HW_DIV_MAX             (16u)       /*!< Largest divisor of the 4-bit interrupt mask counter */
+#define TIMER4_SCHED_SLOT_ZERO              (0u)        /*!< Task runs from the CNT zero interrupt */
+#define TIMER4_SCHED_SLOT_PEAK              (1u)        /*!< Task runs from the CNT peak interrupt */
+#define TIMER4_SCHED_SEVT_CH_NUM            (6u)        /*!< Number of SEVT channels */
+/**
+ * @}
+ */
+
 /**
  * @defgroup TMR4_RCSR_Bit TMR4_RCSR Bit
  * @brief Get the specified TMR4_RCSR register bis value of the specified Timer4 PWM channel
@@ -340,11 +382,65 @@
 /*******************************************************************************
  * Local function prototypes ('static')
  ******************************************************************************/
+/**
+ * @defgroup TIMER4_Local_Functions TIMER4 Local Functions
+ * @{
+ */
+static uint16_t Timer4SchedGcd(uint16_t u16A, uint16_t u16B);
+static uint16_t Timer4SchedHwDiv(uint16_t u16Div);
+static void Timer4SchedSevtCmp(uint32_t u32Ch,
+                                en_functional_state_t enZicCmd,
+                                en_functional_state_t enPicCmd);
+static void Timer4SchedRun(uint8_t u8Slot);
+/**
+ * @}
+ */
 
 /*******************************************************************************
  * Local variable definitions ('static')
  ******************************************************************************/
 
+/**
+ * @defgroup TIMER4_Local_Variables TIMER4 Local Variables
+ * @{
+ */
+
+/* Peak value of the inverter triangular count */
+static uint16_t m_u16InvCycle = 0u;
+
+/* Compare values staged by TIMER4_INV_Stage() */
+static uint16_t m_au16InvStage[3u] = {0u, 0u, 0u};
+
+/* CNT flag(s) raised by the transfer point following the last commit */
+static uint16_t m_u16InvCommitFlag = 0u;
+
+/* CNT flag(s) of m_u16InvCommitFlag cleared by TIMER4_SCHED_IrqHandler() since the last commit */
+static __IO uint16_t m_u16InvCommitSeen = 0u;
+
+/* SVPWM sector(1~6) indexed by N = (X > 0) + 2 * (Z < 0) + 4 * (Y < 0) */
+static const uint8_t m_au8InvSector[8u] = {0u, 2u, 6u, 1u, 4u, 3u, 5u, 0u};
+
+/* Scheduler tasks and SEVT channel divisors(0: not scheduled) */
+static stc_timer4_sched_task_t m_astcSchedTask[TIMER4_SCHED_TASK_MAX];
+static uint8_t m_u8SchedTaskNum = 0u;
+static uint16_t m_au16SchedEvtDiv[TIMER4_SCHED_SEVT_CH_NUM] = {0u, 0u, 0u, 0u, 0u, 0u};
+
+/* Phase index(0:U 1:V 2:W) carrying the max/mid/min duty in every sector */
+static const uint8_t m_au8InvPhase[7u][3u] =
+{
+    {0u, 1u, 2u},
+    {0u, 1u, 2u},
+    {1u, 0u, 2u},
+    {1u, 2u, 0u},
+    {2u, 1u, 0u},
+    {2u, 0u, 1u},
+    {0u, 2u, 1u},
+};
+
+/**
+ * @}
+ */
+
 /*******************************************************************************
  * Function implementation - global ('extern') and local ('static')
  ******************************************************************************/
@@ -2530,6 +2626,720 @@ uint32_t TIMER4_EMB_GetPwmPortPolarity(void)
  * @}
  */
 
+/**
+ * @defgroup TIMER4_INV_Global_Functions TIMER4 Inverter Global Functions
+ * @{
+ */
+
+/**
+ * @brief  Initialize Timer4 as a three-phase center-aligned PWM generator.
+ * @param  [in] pstcInit                Pointer to a @ref stc_timer4_inv_init_t structure
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Initialize successfully
+ *           - ErrorInvalidParameter: pstcInit = NULL or u16CycleVal = 0
+ * @note   The counter runs in triangular mode with CPSR buffered. Each of the
+ *         low channels UL/VL/WL drives its output high while CNT < OCCR, so
+ *         the duty of phase x is OCCRxL / u16CycleVal. The PWM couples run in
+ *         dead timer mode and output the complementary pair TIM4_<t>_OxH/OxL.
+ * @note   All compare values start at 50% duty. The counter is left stopped,
+ *         call TIMER4_CNT_Start() once the ports have been configured.
+ */
+en_result_t TIMER4_INV_Init(const stc_timer4_inv_init_t *pstcInit)
+{
+    uint32_t u32Ch;
+    stc_timer4_cnt_init_t stcCntInit;
+    stc_timer4_oco_init_t stcOcoInit;
+    stc_timer4_pwm_init_t stcPwmInit;
+    stc_oco_low_ch_compare_mode_t stcLowChCmpMode;
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if ((NULL != pstcInit) && (0u != pstcInit->u16CycleVal))
+    {
+        /* Check parameters */
+        DDL_ASSERT(IS_VALID_TIMER4_CNT_CLK_DIV(pstcInit->u16CntClkDiv));
+        DDL_ASSERT(IS_VALID_TIMER4_PWM_CLK_DIV(pstcInit->u16PwmClkDiv));
+        DDL_ASSERT(IS_VALID_TIMER4_OCO_OCCR_BUF_MODE(pstcInit->u16OccrBufMode));
+
+        m_u16InvCycle = pstcInit->u16CycleVal;
+
+        /* Triangular count, CPSR buffered */
+        TIMER4_CNT_StructInit(&stcCntInit);
+        stcCntInit.u16CycleVal = pstcInit->u16CycleVal;
+        stcCntInit.u16CntMode = TIMER4_CNT_MODE_TRIANGLE_WAVE;
+        stcCntInit.u16ClkDiv = pstcInit->u16CntClkDiv;
+        stcCntInit.enBufferCmd = Enable;
+        TIMER4_CNT_Init(&stcCntInit);
+
+        /* Output high while CNT < OCCR: low on the up-count match, high on the
+           down-count match. OCCR = 0 and OCCR = CPSR give 0% and 100%. */
+        stcLowChCmpMode.OCMRx = 0ul;
+        stcLowChCmpMode.OCMRx_f.OPDCL = TIMER4_OCO_OP_HIGH;
+        stcLowChCmpMode.OCMRx_f.OPPKL = TIMER4_OCO_OP_HIGH;
+        stcLowChCmpMode.OCMRx_f.OPUCL = TIMER4_OCO_OP_LOW;
+        stcLowChCmpMode.OCMRx_f.OPZRL = TIMER4_OCO_OP_LOW;
+        stcLowChCmpMode.OCMRx_f.OPNPKL = TIMER4_OCO_OP_LOW;
+        stcLowChCmpMode.OCMRx_f.OPNZRL = TIMER4_OCO_OP_HIGH;
+        /* Same behaviour when the (unused) high channel matches as well */
+        stcLowChCmpMode.OCMRx_f.EOPDCL = TIMER4_OCO_OP_HIGH;
+        stcLowChCmpMode.OCMRx_f.EOPPKL = TIMER4_OCO_OP_HIGH;
+        stcLowChCmpMode.OCMRx_f.EOPUCL = TIMER4_OCO_OP_LOW;
+        stcLowChCmpMode.OCMRx_f.EOPZRL = TIMER4_OCO_OP_LOW;
+        stcLowChCmpMode.OCMRx_f.EOPNPKL = TIMER4_OCO_OP_LOW;
+        stcLowChCmpMode.OCMRx_f.EOPNZRL = TIMER4_OCO_OP_HIGH;
+        stcLowChCmpMode.enExtendMatchCondCmd = Disable;
+
+        TIMER4_OCO_StructInit(&stcOcoInit);
+        stcOcoInit.u16OccrVal = pstcInit->u16CycleVal / 2u;
+        stcOcoInit.u16OccrBufMode = pstcInit->u16OccrBufMode;
+        stcOcoInit.enOcoCmd = Enable;
+
+        TIMER4_PWM_StructInit(&stcPwmInit);
+        stcPwmInit.u16Mode = TIMER4_PWM_DEAD_TIMER_MODE;
+        stcPwmInit.u16ClkDiv = pstcInit->u16PwmClkDiv;
+
+        for (u32Ch = TIMER4_OCO_UL; u32Ch <= TIMER4_OCO_WL; u32Ch += 2ul)
+        {
+            TIMER4_OCO_Init(u32Ch, &stcOcoInit);
+            TIMER4_OCO_SetLowChCompareMode(u32Ch, &stcLowChCmpMode);
+
+            TIMER4_PWM_Init(u32Ch / 2ul, &stcPwmInit);
+            TIMER4_PWM_SetDeadRegionValue(u32Ch / 2ul, pstcInit->u16DeadTime, pstcInit->u16DeadTime);
+        }
+
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Write the compare values of the three phases.
+ * @param  [in] u16CmpU                 OCCR value of phase U (0 ~ u16CycleVal)
+ * @param  [in] u16CmpV                 OCCR value of phase V (0 ~ u16CycleVal)
+ * @param  [in] u16CmpW                 OCCR value of phase W (0 ~ u16CycleVal)
+ * @retval None
+ * @note   The three writes are done with interrupts masked so that no other
+ *         handler can interleave a partial update. With the OCCR buffer
+ *         enabled the values take effect together at the next transfer point,
+ *         provided the call completes before it (e.g. from the zero/peak ISR).
+ */
+void TIMER4_INV_SetCompare(uint16_t u16CmpU, uint16_t u16CmpV, uint16_t u16CmpW)
+{
+    uint32_t u32Primask;
+
+    u32Primask = __get_PRIMASK();
+    __disable_irq();
+    WRITE_REG16(M0P_TMR4->OCCRUL, u16CmpU);
+    WRITE_REG16(M0P_TMR4->OCCRVL, u16CmpV);
+    WRITE_REG16(M0P_TMR4->OCCRWL, u16CmpW);
+    __set_PRIMASK(u32Primask);
+}
+
+/**
+ * @brief  Stage the compare values of the three phases.
+ * @param  [in] u16CmpU                 OCCR value of phase U (0 ~ u16CycleVal)
+ * @param  [in] u16CmpV                 OCCR value of phase V (0 ~ u16CycleVal)
+ * @param  [in] u16CmpW                 OCCR value of phase W (0 ~ u16CycleVal)
+ * @retval None
+ * @note   Nothing is written to the hardware until TIMER4_INV_Commit().
+ */
+void TIMER4_INV_Stage(uint16_t u16CmpU, uint16_t u16CmpV, uint16_t u16CmpW)
+{
+    m_au16InvStage[0u] = u16CmpU;
+    m_au16InvStage[1u] = u16CmpV;
+    m_au16InvStage[2u] = u16CmpW;
+}
+
+/**
+ * @brief  Commit the staged compare values to the OCCR buffers of UL/VL/WL.
+ * @param  [in] u16Guard                Count distance kept from the buffer
+ *                                      transfer point(s) while writing.
+ *                                      It must cover the write time and be
+ *                                      less than half of the cycle value.
+ *                                      0: no guard, see the note below.
+ * @retval An en_result_t enumeration value:
+ *           - Ok: All three values are in the buffers and take effect at the
+ *                 same transfer point
+ *           - ErrorNotReady: CNT is inside the guard window, nothing written
+ *           - ErrorInvalidMode: The OCCR buffers of UL/VL/WL are not all in
+ *                               the same transfer mode, or they are disabled
+ *           - ErrorInvalidParameter: u16Guard is too large for the cycle
+ * @note   The three buffer registers are written with interrupts masked and
+ *         only while CNT is at least u16Guard counts away from a zero/peak
+ *         transfer point, so a transfer never catches part of the update.
+ *         Inside the guard window the call returns at once, retry it later.
+ *         With the OCCR link transfer enabled the transfer happens at the
+ *         next unmasked zero/peak, which is also when the CNT flag is raised,
+ *         so TIMER4_INV_GetCommitStatus() stays coherent.
+ * @note   From the zero/peak interrupt handler (e.g. a TIMER4_SCHED task)
+ *         the transfer point has just passed and CNT is always inside the
+ *         guard window. Pass u16Guard = 0 there: the write completes long
+ *         before the next transfer point.
+ */
+en_result_t TIMER4_INV_Commit(uint16_t u16Guard)
+{
+    uint32_t u32Primask;
+    uint16_t u16BufMode;
+    uint16_t u16Cnt;
+    uint16_t u16Cycle;
+    uint16_t u16Flag = 0u;
+    en_result_t enRet = ErrorInvalidMode;
+
+    u16BufMode = TIMER4_OCO_GetOccrBufMode(TIMER4_OCO_UL);
+    if ((TIMER4_OCO_OCCR_BUF_DISABLE != u16BufMode) && \
+        (u16BufMode == TIMER4_OCO_GetOccrBufMode(TIMER4_OCO_VL)) && \
+        (u16BufMode == TIMER4_OCO_GetOccrBufMode(TIMER4_OCO_WL)))
+    {
+        if (TIMER4_OCO_OCCR_BUF_CNT_PEAK != u16BufMode)
+        {
+            u16Flag |= TIMER4_CNT_FLAG_ZERO;
+        }
+
+        if (TIMER4_OCO_OCCR_BUF_CNT_ZERO != u16BufMode)
+        {
+            u16Flag |= TIMER4_CNT_FLAG_PEAK;
+        }
+
+        u16Cycle = TIMER4_CNT_GetCycleVal();
+        if ((uint32_t)u16Guard * 2ul >= (uint32_t)u16Cycle)
+        {
+            enRet = ErrorInvalidParameter;
+        }
+        else
+        {
+            enRet = ErrorNotReady;
+
+            u32Primask = __get_PRIMASK();
+            __disable_irq();
+
+            u16Cnt = TIMER4_CNT_GetCountVal();
+            if ((0u == u16Guard) || (bM0P_TMR4->CCSR_b.STOP != 0ul) || \
+                (((0u == (u16Flag & TIMER4_CNT_FLAG_ZERO)) || (u16Cnt > u16Guard)) && \
+                 ((0u == (u16Flag & TIMER4_CNT_FLAG_PEAK)) || (u16Cnt < (u16Cycle - u16Guard)))))
+            {
+                WRITE_REG16(M0P_TMR4->OCCRUL, m_au16InvStage[0u]);
+                WRITE_REG16(M0P_TMR4->OCCRVL, m_au16InvStage[1u]);
+                WRITE_REG16(M0P_TMR4->OCCRWL, m_au16InvStage[2u]);
+                TIMER4_CNT_ClearFlag(u16Flag);
+                m_u16InvCommitFlag = u16Flag;
+                m_u16InvCommitSeen = 0u;
+                enRet = Ok;
+            }
+
+            __set_PRIMASK(u32Primask);
+        }
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Check whether the last committed values have been transferred.
+ * @param  None
+ * @retval An en_flag_status_t enumeration value:
+ *           - Set: A buffer transfer point has passed since the last commit,
+ *                  the committed values are the active compare values
+ *           - Reset: The transfer is still pending or nothing was committed
+ * @note   The transfer is detected from the CNT zero/peak flags, or from
+ *         TIMER4_SCHED_IrqHandler() having cleared one of them since the
+ *         commit. Any other CNT interrupt handler that clears the same flag
+ *         hides the transfer.
+ */
+en_flag_status_t TIMER4_INV_GetCommitStatus(void)
+{
+    en_flag_status_t enStatus = Reset;
+
+    if ((0u != m_u16InvCommitFlag) && \
+        ((0u != m_u16InvCommitSeen) || \
+         (0u != READ_REG16_BIT(M0P_TMR4->CCSR, m_u16InvCommitFlag))))
+    {
+        enStatus = Set;
+    }
+
+    return enStatus;
+}
+
+/**
+ * @brief  Space vector modulation of a stationary frame voltage vector.
+ * @param  [in] i16Alpha                Alpha component, Q15 of Vdc/sqrt(3)
+ * @param  [in] i16Beta                 Beta component, Q15 of Vdc/sqrt(3)
+ * @retval Sector of the vector (1 ~ 6), 0 for the zero vector.
+ * @note   A magnitude up to 32767 stays in the linear range (inscribed circle
+ *         of the hexagon). Longer vectors are scaled back onto the hexagon.
+ * @note   Integer only: the dwell times come from the X/Y/Z projections and
+ *         the sector tables, the duty of the max/mid/min phase is
+ *         T0/2 + T1 + T2, T0/2 + T2 and T0/2. The result is equivalent to
+ *         sine-triangle modulation with min-max zero sequence injection and
+ *         is written through TIMER4_INV_SetCompare().
+ */
+uint8_t TIMER4_INV_Svpwm(int16_t i16Alpha, int16_t i16Beta)
+{
+    int32_t i32X;
+    int32_t i32Y;
+    int32_t i32Z;
+    int32_t i32T1 = 0;
+    int32_t i32T2 = 0;
+    int32_t i32Ka;
+    uint32_t u32Min;
+    uint32_t au32Duty[3u];
+    uint16_t au16Cmp[3u];
+    uint8_t u8Sector;
+    const uint8_t *pu8Phase;
+
+    i32Ka = (TIMER4_INV_SQRT3_DIV2 * (int32_t)i16Alpha) / TIMER4_INV_DUTY_FULL;
+    i32X = (int32_t)i16Beta;
+    i32Y = ((int32_t)i16Beta / 2) + i32Ka;
+    i32Z = ((int32_t)i16Beta / 2) - i32Ka;
+
+    u8Sector = m_au8InvSector[((i32X > 0) ? 1u : 0u) | \
+                              ((i32Z < 0) ? 2u : 0u) | \
+                              ((i32Y < 0) ? 4u : 0u)];
+
+    /* T1: active vector on the sector's leading edge, T2: trailing edge */
+    switch (u8Sector)
+    {
+        case 1u:
+            i32T1 = -i32Z;
+            i32T2 = i32X;
+            break;
+        case 2u:
+            i32T1 = i32Z;
+            i32T2 = i32Y;
+            break;
+        case 3u:
+            i32T1 = i32X;
+            i32T2 = -i32Y;
+            break;
+        case 4u:
+            i32T1 = -i32X;
+            i32T2 = i32Z;
+            break;
+        case 5u:
+            i32T1 = -i32Y;
+            i32T2 = -i32Z;
+            break;
+        case 6u:
+            i32T1 = i32Y;
+            i32T2 = -i32X;
+            break;
+        default:
+            break;
+    }
+
+    /* Over-modulation: keep the angle, clamp onto the hexagon */
+    if ((i32T1 + i32T2) > TIMER4_INV_DUTY_FULL)
+    {
+        i32T1 = (i32T1 * TIMER4_INV_DUTY_FULL) / (i32T1 + i32T2);
+        i32T2 = TIMER4_INV_DUTY_FULL - i32T1;
+    }
+
+    u32Min = (uint32_t)(TIMER4_INV_DUTY_FULL - i32T1 - i32T2) / 2ul;
+    pu8Phase = m_au8InvPhase[u8Sector];
+    au32Duty[pu8Phase[0u]] = u32Min + (uint32_t)i32T1 + (uint32_t)i32T2;
+    au32Duty[pu8Phase[1u]] = u32Min + (uint32_t)i32T2;
+    au32Duty[pu8Phase[2u]] = u32Min;
+
+    au16Cmp[0u] = (uint16_t)((au32Duty[0u] * m_u16InvCycle) >> 15u);
+    au16Cmp[1u] = (uint16_t)((au32Duty[1u] * m_u16InvCycle) >> 15u);
+    au16Cmp[2u] = (uint16_t)((au32Duty[2u] * m_u16InvCycle) >> 15u);
+    TIMER4_INV_SetCompare(au16Cmp[0u], au16Cmp[1u], au16Cmp[2u]);
+
+    return u8Sector;
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup TIMER4_SCHED_Global_Functions TIMER4 Scheduler Global Functions
+ * @{
+ */
+
+/**
+ * @brief  Register a task run once every u16Divisor PWM periods.
+ * @param  [in] u16Divisor              Task period in PWM periods (zero events), >= 1
+ * @param  [in] pfnTask                 Task callback, called in interrupt context
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Task registered
+ *           - ErrorBufferFull: TIMER4_SCHED_TASK_MAX tasks are registered
+ *           - ErrorInvalidParameter: u16Divisor = 0 or pfnTask = NULL
+ * @note   Call before TIMER4_SCHED_Start().
+ */
+en_result_t TIMER4_SCHED_AddTask(uint16_t u16Divisor,
+                                func_ptr_timer4_sched_t pfnTask)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if ((0u != u16Divisor) && (NULL != pfnTask))
+    {
+        if (m_u8SchedTaskNum < TIMER4_SCHED_TASK_MAX)
+        {
+            m_astcSchedTask[m_u8SchedTaskNum].pfnTask = pfnTask;
+            m_astcSchedTask[m_u8SchedTaskNum].u16Divisor = u16Divisor;
+            m_u8SchedTaskNum++;
+            enRet = Ok;
+        }
+        else
+        {
+            enRet = ErrorBufferFull;
+        }
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Let a SEVT channel trigger only once every u16Divisor PWM periods.
+ * @param  [in] u32Ch                   Timer4 SEVT channel
+ *         This parameter can be one of the following values:
+ *           @arg TIMER4_SEVT_UH:       Timer4 SEVT channel:UH
+ *           @arg TIMER4_SEVT_UL:       Timer4 SEVT channel:UL
+ *           @arg TIMER4_SEVT_VH:       Timer4 SEVT channel:VH
+ *           @arg TIMER4_SEVT_VL:       Timer4 SEVT channel:VL
+ *           @arg TIMER4_SEVT_WH:       Timer4 SEVT channel:WH
+ *           @arg TIMER4_SEVT_WL:       Timer4 SEVT channel:WL
+ * @param  [in] u16Divisor              Event period in PWM periods (1 ~ 16)
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Event registered
+ *           - ErrorInvalidParameter: u32Ch is invalid or u16Divisor is out of range
+ * @note   The channel itself is set up with TIMER4_SEVT_Init(). The SEVT mask
+ *         compares with the CNT interrupt mask counters, so u16Divisor must
+ *         end up equal to the zero or the peak slot divisor chosen by
+ *         TIMER4_SCHED_Start(), e.g. the divisor of one of the tasks.
+ */
+en_result_t TIMER4_SCHED_AddEvent(uint32_t u32Ch, uint16_t u16Divisor)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if ((IS_VALID_TIMER4_SEVT_CH(u32Ch)) && \
+        (0u != u16Divisor) && (u16Divisor <= TIMER4_SCHED_HW_DIV_MAX))
+    {
+        m_au16SchedEvtDiv[u32Ch] = u16Divisor;
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Program the CNT interrupt mask counters and start dispatching.
+ * @param  None
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Started
+ *           - ErrorInvalidMode: Nothing registered, or a SEVT divisor fits
+ *                               neither interrupt mask counter
+ * @note   Two hardware rates are available: the zero interrupt with mask
+ *         counter ZIM and the peak interrupt with mask counter PIM, each
+ *         dividing the PWM rate by 1 ~ 16. The fastest divisor gets the zero
+ *         interrupt. The peak interrupt gets the largest divisor <= 16 common
+ *         to the remaining tasks, so masked periods cost no ISR entry. Only a
+ *         task whose divisor exceeds its slot divisor keeps a software count,
+ *         e.g. 20 kHz PWM with a 1 kHz task: PIM = 9 gives a 2 kHz peak
+ *         interrupt and the task runs every 2nd entry.
+ * @note   The counter is expected to be initialized (and usually running in
+ *         triangular mode, which places the peak slot half a period away
+ *         from the zero slot). Register TIMER4_SCHED_IrqHandler() for
+ *         INT_TMR4_GUDF and/or INT_TMR4_GOVF.
+ */
+en_result_t TIMER4_SCHED_Start(void)
+{
+    uint8_t i;
+    uint16_t u16DivZ = 0xFFFFu;
+    uint16_t u16DivP;
+    uint16_t u16Gcd = 0u;
+    uint16_t u16SlotUsed = 0u;
+    en_result_t enRet = ErrorInvalidMode;
+
+    /* Zero slot: fastest divisor */
+    for (i = 0u; i < m_u8SchedTaskNum; i++)
+    {
+        if (m_astcSchedTask[i].u16Divisor < u16DivZ)
+        {
+            u16DivZ = m_astcSchedTask[i].u16Divisor;
+        }
+    }
+
+    for (i = 0u; i < TIMER4_SCHED_SEVT_CH_NUM; i++)
+    {
+        if ((0u != m_au16SchedEvtDiv[i]) && (m_au16SchedEvtDiv[i] < u16DivZ))
+        {
+            u16DivZ = m_au16SchedEvtDiv[i];
+        }
+    }
+
+    if (0xFFFFu != u16DivZ)
+    {
+        u16DivZ = Timer4SchedHwDiv(u16DivZ);
+
+        /* Peak slot: largest hardware divisor common to everything else */
+        for (i = 0u; i < m_u8SchedTaskNum; i++)
+        {
+            if (m_astcSchedTask[i].u16Divisor != u16DivZ)
+            {
+                u16Gcd = Timer4SchedGcd(u16Gcd, m_astcSchedTask[i].u16Divisor);
+            }
+        }
+
+        for (i = 0u; i < TIMER4_SCHED_SEVT_CH_NUM; i++)
+        {
+            if ((0u != m_au16SchedEvtDiv[i]) && (m_au16SchedEvtDiv[i] != u16DivZ))
+            {
+                u16Gcd = Timer4SchedGcd(u16Gcd, m_au16SchedEvtDiv[i]);
+            }
+        }
+
+        u16DivP = Timer4SchedHwDiv(u16Gcd);
+
+        enRet = Ok;
+        for (i = 0u; i < TIMER4_SCHED_SEVT_CH_NUM; i++)
+        {
+            if ((0u != m_au16SchedEvtDiv[i]) && \
+                (m_au16SchedEvtDiv[i] != u16DivZ) && (m_au16SchedEvtDiv[i] != u16DivP))
+            {
+                enRet = ErrorInvalidMode;
+            }
+        }
+
+        /* A peak slot not slower than the zero slot only adds ISR entries
+           when the zero slot can carry the tasks as well */
+        if ((Ok == enRet) && (u16DivP <= u16DivZ) && (0u == (u16Gcd % u16DivZ)))
+        {
+            for (i = 0u; i < TIMER4_SCHED_SEVT_CH_NUM; i++)
+            {
+                if ((0u != m_au16SchedEvtDiv[i]) && (m_au16SchedEvtDiv[i] != u16DivZ))
+                {
+                    break;
+                }
+            }
+
+            if (TIMER4_SCHED_SEVT_CH_NUM == i)
+            {
+                u16DivP = u16DivZ;
+                u16Gcd = 0u;
+            }
+        }
+    }
+
+    if (Ok == enRet)
+    {
+        for (i = 0u; i < m_u8SchedTaskNum; i++)
+        {
+            if ((0u == u16Gcd) || (m_astcSchedTask[i].u16Divisor == u16DivZ))
+            {
+                m_astcSchedTask[i].u8Slot = TIMER4_SCHED_SLOT_ZERO;
+                m_astcSchedTask[i].u16Ratio = m_astcSchedTask[i].u16Divisor / u16DivZ;
+            }
+            else
+            {
+                m_astcSchedTask[i].u8Slot = TIMER4_SCHED_SLOT_PEAK;
+                m_astcSchedTask[i].u16Ratio = m_astcSchedTask[i].u16Divisor / u16DivP;
+            }
+            m_astcSchedTask[i].u16Cnt = 0u;
+            u16SlotUsed |= (uint16_t)(1u << m_astcSchedTask[i].u8Slot);
+        }
+
+        TIMER4_CNT_IntCmd(TIMER4_CNT_IT_ZERO, Disable);
+        TIMER4_CNT_IntCmd(TIMER4_CNT_IT_PEAK, Disable);
+        TIMER4_CNT_SetIntMaskTimes(TIMER4_CNT_IT_ZERO, (uint16_t)(u16DivZ - 1u));
+        TIMER4_CNT_SetIntMaskTimes(TIMER4_CNT_IT_PEAK, (uint16_t)(u16DivP - 1u));
+
+        /* SEVT fires when the selected mask counter equals AMC */
+        for (i = 0u; i < TIMER4_SCHED_SEVT_CH_NUM; i++)
+        {
+            if (0u != m_au16SchedEvtDiv[i])
+            {
+                (void)TIMER4_SEVT_SetMaskTimes((uint32_t)i, TIMER4_SEVT_MASK_0);
+                if (m_au16SchedEvtDiv[i] == u16DivZ)
+                {
+                    Timer4SchedSevtCmp((uint32_t)i, Enable, Disable);
+                }
+                else
+                {
+                    Timer4SchedSevtCmp((uint32_t)i, Disable, Enable);
+                }
+            }
+        }
+
+        TIMER4_CNT_ClearFlag(TIMER4_CNT_FLAG_ZERO | TIMER4_CNT_FLAG_PEAK);
+        if (0u != (u16SlotUsed & (1u << TIMER4_SCHED_SLOT_ZERO)))
+        {
+            TIMER4_CNT_IntCmd(TIMER4_CNT_IT_ZERO, Enable);
+        }
+
+        if (0u != (u16SlotUsed & (1u << TIMER4_SCHED_SLOT_PEAK)))
+        {
+            TIMER4_CNT_IntCmd(TIMER4_CNT_IT_PEAK, Enable);
+        }
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Stop dispatching and unregister all tasks and events.
+ * @param  None
+ * @retval None
+ * @note   The CNT zero/peak interrupts are disabled and the SEVT channels
+ *         registered with TIMER4_SCHED_AddEvent() stop comparing with the
+ *         mask counters. The mask counters themselves are left as they are.
+ */
+void TIMER4_SCHED_Stop(void)
+{
+    uint8_t i;
+
+    TIMER4_CNT_IntCmd(TIMER4_CNT_IT_ZERO, Disable);
+    TIMER4_CNT_IntCmd(TIMER4_CNT_IT_PEAK, Disable);
+
+    for (i = 0u; i < TIMER4_SCHED_SEVT_CH_NUM; i++)
+    {
+        if (0u != m_au16SchedEvtDiv[i])
+        {
+            Timer4SchedSevtCmp((uint32_t)i, Disable, Disable);
+            m_au16SchedEvtDiv[i] = 0u;
+        }
+    }
+
+    m_u8SchedTaskNum = 0u;
+}
+
+/**
+ * @brief  Scheduler interrupt handler.
+ * @param  None
+ * @retval None
+ * @note   Call from the INT_TMR4_GUDF and INT_TMR4_GOVF interrupt callbacks.
+ *         Tasks of one slot run in registration order.
+ * @note   A cleared zero/peak flag is recorded for
+ *         TIMER4_INV_GetCommitStatus(), so the inverter commit status stays
+ *         valid with the scheduler running. A task committing from here
+ *         passes u16Guard = 0 to TIMER4_INV_Commit().
+ */
+void TIMER4_SCHED_IrqHandler(void)
+{
+    if ((Set == TIMER4_CNT_GetFlag(TIMER4_CNT_FLAG_ZERO)) && \
+        (0u != READ_REG16_BIT(M0P_TMR4->CCSR, TIMER4_CNT_IT_ZERO)))
+    {
+        TIMER4_CNT_ClearFlag(TIMER4_CNT_FLAG_ZERO);
+        m_u16InvCommitSeen |= (uint16_t)(m_u16InvCommitFlag & TIMER4_CNT_FLAG_ZERO);
+        Timer4SchedRun(TIMER4_SCHED_SLOT_ZERO);
+    }
+
+    if ((Set == TIMER4_CNT_GetFlag(TIMER4_CNT_FLAG_PEAK)) && \
+        (0u != READ_REG16_BIT(M0P_TMR4->CCSR, TIMER4_CNT_IT_PEAK)))
+    {
+        TIMER4_CNT_ClearFlag(TIMER4_CNT_FLAG_PEAK);
+        m_u16InvCommitSeen |= (uint16_t)(m_u16InvCommitFlag & TIMER4_CNT_FLAG_PEAK);
+        Timer4SchedRun(TIMER4_SCHED_SLOT_PEAK);
+    }
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/**
+ * @addtogroup TIMER4_Local_Functions TIMER4 Local Functions
+ * @{
+ */
+
+/**
+ * @brief  Greatest common divisor, Timer4SchedGcd(0, n) = n.
+ * @param  [in] u16A                    First value
+ * @param  [in] u16B                    Second value
+ * @retval The greatest common divisor.
+ */
+static uint16_t Timer4SchedGcd(uint16_t u16A, uint16_t u16B)
+{
+    uint16_t u16Tmp;
+
+    while (0u != u16B)
+    {
+        u16Tmp = u16A % u16B;
+        u16A = u16B;
+        u16B = u16Tmp;
+    }
+
+    return u16A;
+}
+
+/**
+ * @brief  Largest divisor of u16Div the 4-bit interrupt mask counter supports.
+ * @param  [in] u16Div                  Requested divisor (0 is treated as 1)
+ * @retval Divisor in 1 ~ TIMER4_SCHED_HW_DIV_MAX dividing u16Div.
+ */
+static uint16_t Timer4SchedHwDiv(uint16_t u16Div)
+{
+    uint16_t u16HwDiv = 1u;
+    uint16_t i;
+
+    for (i = TIMER4_SCHED_HW_DIV_MAX; (i > 1u) && (0u != u16Div); i--)
+    {
+        if (0u == (u16Div % i))
+        {
+            u16HwDiv = i;
+            break;
+        }
+    }
+
+    return u16HwDiv;
+}
+
+/**
+ * @brief  Select the CNT interrupt mask counter a SEVT channel compares with.
+ * @param  [in] u32Ch                   Timer4 SEVT channel
+ * @param  [in] enZicCmd                Enable or disable the compare with the zero interrupt mask counter
+ * @param  [in] enPicCmd                Enable or disable the compare with the peak interrupt mask counter
+ * @retval None
+ * @note   The count match conditions and the mask times of the channel are kept.
+ */
+static void Timer4SchedSevtCmp(uint32_t u32Ch,
+                                en_functional_state_t enZicCmd,
+                                en_functional_state_t enPicCmd)
+{
+    uint16_t u16Scsr;
+    stc_timer4_sevt_trigger_cond_t stcTriggerCond;
+
+    u16Scsr = READ_REG16(*TMR4_SCSRx(M0P_TMR4, u32Ch));
+
+    stcTriggerCond.enDownMatchCmd = (0u != (u16Scsr & TMR4_SCSR_DEN)) ? Enable : Disable;
+    stcTriggerCond.enPeakMatchCmd = (0u != (u16Scsr & TMR4_SCSR_PEN)) ? Enable : Disable;
+    stcTriggerCond.enUpMatchCmd = (0u != (u16Scsr & TMR4_SCSR_UEN)) ? Enable : Disable;
+    stcTriggerCond.enZeroMatchCmd = (0u != (u16Scsr & TMR4_SCSR_ZEN)) ? Enable : Disable;
+    stcTriggerCond.enCmpAmcZicCmd = enZicCmd;
+    stcTriggerCond.enCmpAmcPicCmd = enPicCmd;
+    stcTriggerCond.u16MaskTimes = TIMER4_SEVT_GetMaskTimes(u32Ch);
+    (void)TIMER4_SEVT_SetTriggerCondition(u32Ch, &stcTriggerCond);
+}
+
+/**
+ * @brief  Run the due tasks of one interrupt slot.
+ * @param  [in] u8Slot                  TIMER4_SCHED_SLOT_ZERO or TIMER4_SCHED_SLOT_PEAK
+ * @retval None
+ */
+static void Timer4SchedRun(uint8_t u8Slot)
+{
+    uint8_t i;
+    stc_timer4_sched_task_t *pstcTask;
+
+    for (i = 0u; i < m_u8SchedTaskNum; i++)
+    {
+        pstcTask = &m_astcSchedTask[i];
+        if (u8Slot == pstcTask->u8Slot)
+        {
+            pstcTask->u16Cnt++;
+            if (pstcTask->u16Cnt >= pstcTask->u16Ratio)
+            {
+                pstcTask->u16Cnt = 0u;
+                pstcTask->pfnTask();
+            }
+        }
+    }
+}
+
 /**
  * @}
  */
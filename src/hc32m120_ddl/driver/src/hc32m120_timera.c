@@ -55,6 +55,7 @@
  ******************************************************************************/
 #include "hc32m120_timera.h"
 #include "hc32m120_utility.h"
+#include "hc32m120_dma.h"
 
 /**
  * @addtogroup HC32M120_DDL_Driver
@@ -72,6 +73,32 @@
 /*******************************************************************************
  * Local type definitions ('typedef')
  ******************************************************************************/
+/**
+ * @defgroup TIMERA_Local_Types TimerA Local Types
+ * @{
+ */
+
+/**
+ * @brief TimerA quadrature encoder context.
+ */
+typedef struct
+{
+    __IO int32_t  i32High;              /*!< Accounted 16-bit counter wraps. */
+    __IO int32_t  i32IndexPos;          /*!< Extended position at the last index pulse. */
+    __IO uint32_t u32IndexCnt;          /*!< Index pulses seen. */
+    int32_t  i32WinPos;                 /*!< Position at the start of the speed window. */
+    uint32_t u32WinTime;                /*!< Time stamp at the start of the speed window. */
+    int32_t  i32Speed;                  /*!< Last speed, counts per second. */
+    uint32_t u32TickFreq;               /*!< Time stamp frequency. */
+    uint32_t u32MinCount;               /*!< Counts closing a speed window. */
+    uint32_t u32MaxWindow;              /*!< Ticks closing a speed window. */
+    uint8_t  u8IndexCh;                 /*!< Index capture channel. */
+    uint8_t  u8WinValid;                /*!< Speed window started. */
+} stc_timera_enc_ctx_t;
+
+/**
+ * @}
+ */
 
 /*******************************************************************************
  * Local pre-processor symbols/macros ('#define')
@@ -86,6 +113,9 @@
  * @{
  */
 #define TIMERA_PWM_CHANNEL_NUMBER           ((uint8_t)0x02u)         /*!< TIMERA PWM channel number */
+#define TIMERA_ENC_HALF_RANGE               ((uint16_t)0x8000u)      /*!< Half of the 16-bit encoder count range */
+#define TIMERA_WAVE_LEN_MAX                 ((uint16_t)1023u)        /*!< DMA transfer count limit */
+#define TIMERA_WAVE_DMA_CH_NUM              (2u)                     /*!< Number of DMA channels */
 /**
  * @}
  */
@@ -150,6 +180,15 @@
 (   (TIMERA_CHANNEL_CH1 == (x))                 ||                             \
     (TIMERA_CHANNEL_CH2 == (x)))
 
+#define IS_TIMERA_ENC_MODE(x)                                                  \
+(   (TIMERA_ENC_MODE_X1 == (x))                 ||                             \
+    (TIMERA_ENC_MODE_X2 == (x))                 ||                             \
+    (TIMERA_ENC_MODE_X4 == (x)))
+
+#define IS_TIMERA_ENC_INDEX_CHANNEL(x)                                         \
+(   (TIMERA_ENC_INDEX_NONE == (x))              ||                             \
+    IS_TIMERA_CHANNEL(x))
+
 #define IS_TIMERA_CACHE_CHANNEL(x)                                             \
 (   (TIMERA_CHANNEL_CH1 == (x)))
 
@@ -318,6 +357,12 @@
 /*******************************************************************************
  * Local variable definitions ('static')
  ******************************************************************************/
+static stc_timera_enc_ctx_t m_stcTimeraEnc;
+
+#if (DDL_DMA_ENABLE == DDL_ON)
+/* Self-linked descriptor replaying the waveform table, one per DMA channel */
+static stc_dma_llp_descriptor_t m_astcTimeraWaveDesc[TIMERA_WAVE_DMA_CH_NUM];
+#endif /* DDL_DMA_ENABLE */
 
 /*******************************************************************************
  * Function implementation - global ('extern') and local ('static')
@@ -1813,6 +1858,401 @@ void TIMERA_IntCmd(M0P_TMRA_TypeDef *TMRAx,
     }
 }
 
+/**
+ * @brief  Configure TimerA as a quadrature encoder counter.
+ * @param  [in] TMRAx                   Pointer to TimerA instance register base
+ *         This parameter can be one of the following values:
+ *           @arg M0P_TMRA:             TimerA unit 1 instance register base
+ * @param  [in] pstcEncInit             Pointer to a @ref stc_timera_enc_init_t structure
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Initialize successfully
+ *           - ErrorInvalidParameter: Invalid parameter
+ * @note   The A/B phases are TIMA_<t>_CLKA/CLKB, counted by the hardware
+ *         up/down conditions over the full 16-bit range. The 16-bit counter
+ *         is extended to 32 bits in TIMERA_ENC_IrqHandler() on overflow and
+ *         underflow, and the index pulse is captured on the rising edge of
+ *         TIMA_<t>_PWMn, so there is no interrupt per encoder edge.
+ * @note   The counter is not started, call TIMERA_Cmd() afterwards. Register
+ *         TIMERA_ENC_IrqHandler() for INT_TMRA_OVF, INT_TMRA_UDF and, with an
+ *         index input, the capture interrupt of u8IndexCh.
+ */
+en_result_t TIMERA_ENC_Init(M0P_TMRA_TypeDef *TMRAx,
+                            const stc_timera_enc_init_t *pstcEncInit)
+{
+    stc_timera_init_t stcInit;
+    stc_timera_ic_init_t stcIcInit;
+    en_result_t enRet = Ok;
+
+    /* Check TMRAx instance and pstcEncInit */
+    if ((!IS_TIMERA_INSTANCE(TMRAx)) || (NULL == pstcEncInit))
+    {
+        enRet = ErrorInvalidParameter;
+    }
+    else
+    {
+        /* Check parameters */
+        DDL_ASSERT(IS_TIMERA_ENC_MODE(pstcEncInit->u16EncMode));
+        DDL_ASSERT(IS_FUNCTIONAL_STATE(pstcEncInit->enFilterCmd));
+        DDL_ASSERT(IS_TIMERA_CLKA_PORT_FILTER_CLKDIV(pstcEncInit->u16ClkAFilterClkDiv));
+        DDL_ASSERT(IS_TIMERA_CLKB_PORT_FILTER_CLKDIV(pstcEncInit->u16ClkBFilterClkDiv));
+        DDL_ASSERT(IS_TIMERA_ENC_INDEX_CHANNEL(pstcEncInit->u8IndexCh));
+        DDL_ASSERT(IS_TIMERA_IC_PWM_PORT_FILTER_CLKDIV(pstcEncInit->u16IndexFilterClkDiv));
+
+        TIMERA_Cmd(TMRAx, Disable);
+
+        TIMERA_StructInit(&stcInit);
+        stcInit.u16CountMode = TIMERA_SAWTOOTH_WAVE;
+        stcInit.u16PeriodVal = 0xFFFFu;
+        stcInit.u16ClkAFilterClkDiv = pstcEncInit->u16ClkAFilterClkDiv;
+        stcInit.u16ClkBFilterClkDiv = pstcEncInit->u16ClkBFilterClkDiv;
+        /* A leading B counts up */
+        stcInit.u16HwUpCondition = TIMERA_HWUP_CLKB_LOW_CLKA_RISING;
+        stcInit.u16HwDownCondition = TIMERA_HWDOWN_CLKB_HIGH_CLKA_RISING;
+        if (TIMERA_ENC_MODE_X1 != pstcEncInit->u16EncMode)
+        {
+            stcInit.u16HwUpCondition |= TIMERA_HWUP_CLKB_HIGH_CLKA_FALLING;
+            stcInit.u16HwDownCondition |= TIMERA_HWDOWN_CLKB_LOW_CLKA_FALLING;
+        }
+        if (TIMERA_ENC_MODE_X4 == pstcEncInit->u16EncMode)
+        {
+            stcInit.u16HwUpCondition |= (TIMERA_HWUP_CLKA_HIGH_CLKB_RISING |
+                                         TIMERA_HWUP_CLKA_LOW_CLKB_FALLING);
+            stcInit.u16HwDownCondition |= (TIMERA_HWDOWN_CLKA_LOW_CLKB_RISING |
+                                           TIMERA_HWDOWN_CLKA_HIGH_CLKB_FALLING);
+        }
+        (void)TIMERA_Init(TMRAx, &stcInit);
+        TIMERA_ClkAFilterCmd(TMRAx, pstcEncInit->enFilterCmd);
+        TIMERA_ClkBFilterCmd(TMRAx, pstcEncInit->enFilterCmd);
+
+        m_stcTimeraEnc.i32High = 0;
+        m_stcTimeraEnc.i32IndexPos = 0;
+        m_stcTimeraEnc.u32IndexCnt = 0ul;
+        m_stcTimeraEnc.i32Speed = 0;
+        m_stcTimeraEnc.u32TickFreq = pstcEncInit->u32TickFreq;
+        m_stcTimeraEnc.u32MinCount = pstcEncInit->u32MinCount;
+        m_stcTimeraEnc.u32MaxWindow = pstcEncInit->u32MaxWindow;
+        m_stcTimeraEnc.u8IndexCh = pstcEncInit->u8IndexCh;
+        m_stcTimeraEnc.u8WinValid = 0u;
+
+        TIMERA_ClearFlag(TMRAx, TIMERA_FLAG_OVF | TIMERA_FLAG_UDF);
+        TIMERA_IntCmd(TMRAx, TIMERA_INT_OVF | TIMERA_INT_UDF, Enable);
+
+        if (TIMERA_ENC_INDEX_NONE != pstcEncInit->u8IndexCh)
+        {
+            TIMERA_IC_StructInit(&stcIcInit);
+            stcIcInit.u16PwmFilterClkDiv = pstcEncInit->u16IndexFilterClkDiv;
+            stcIcInit.u16CaptureCondition = TIMERA_IC_PWM_RISING;
+            (void)TIMERA_IC_Init(TMRAx, pstcEncInit->u8IndexCh, &stcIcInit);
+            TIMERA_IC_FilterCmd(TMRAx, pstcEncInit->u8IndexCh, pstcEncInit->enFilterCmd);
+
+            TIMERA_ClearFlag(TMRAx, (uint16_t)(TIMERA_FLAG_CMP1 << pstcEncInit->u8IndexCh));
+            TIMERA_IntCmd(TMRAx, (uint16_t)(TIMERA_INT_CMP1 << pstcEncInit->u8IndexCh), Enable);
+        }
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Get the 32-bit extended encoder position.
+ * @param  [in] TMRAx                   Pointer to TimerA instance register base
+ *         This parameter can be one of the following values:
+ *           @arg M0P_TMRA:             TimerA unit 1 instance register base
+ * @retval Position in counts, wrapping modulo 2^32.
+ * @note   Lock-free: the read is retried when TIMERA_ENC_IrqHandler() ran in
+ *         between, and a wrap whose interrupt is still pending (e.g. called
+ *         with interrupts masked or from a higher priority handler) is
+ *         accounted from the OVF/UDF flag and the counter half. The handler
+ *         must run within 32768 counts of a wrap.
+ */
+int32_t TIMERA_ENC_GetPosition(M0P_TMRA_TypeDef *TMRAx)
+{
+    int32_t i32High;
+    uint16_t u16Cnt;
+    uint16_t u16Flag;
+
+    /* Check parameters */
+    DDL_ASSERT(IS_TIMERA_INSTANCE(TMRAx));
+
+    do
+    {
+        i32High = m_stcTimeraEnc.i32High;
+        u16Cnt = READ_REG16(TMRAx->CNTER);
+        u16Flag = READ_REG16_BIT(TMRAx->BCSTR, (TIMERA_FLAG_OVF | TIMERA_FLAG_UDF));
+    } while (i32High != m_stcTimeraEnc.i32High);
+
+    if ((0u != (u16Flag & TIMERA_FLAG_OVF)) && (u16Cnt < TIMERA_ENC_HALF_RANGE))
+    {
+        i32High++;
+    }
+    else if ((0u != (u16Flag & TIMERA_FLAG_UDF)) && (u16Cnt >= TIMERA_ENC_HALF_RANGE))
+    {
+        i32High--;
+    }
+    else
+    {
+        /* Wrap already accounted */
+    }
+
+    return (int32_t)(((uint32_t)i32High << 16u) | (uint32_t)u16Cnt);
+}
+
+/**
+ * @brief  Get the extended position latched by the last index pulse.
+ * @param  [in] TMRAx                   Pointer to TimerA instance register base
+ *         This parameter can be one of the following values:
+ *           @arg M0P_TMRA:             TimerA unit 1 instance register base
+ * @param  [out] pi32Pos                Position at the last index pulse
+ * @param  [out] pu32Cnt                Number of index pulses seen, may be NULL
+ * @retval An en_result_t enumeration value:
+ *           - Ok: pi32Pos is valid
+ *           - ErrorNotReady: No index pulse seen yet
+ *           - ErrorInvalidParameter: Invalid parameter
+ */
+en_result_t TIMERA_ENC_GetIndex(M0P_TMRA_TypeDef *TMRAx, int32_t *pi32Pos,
+                                uint32_t *pu32Cnt)
+{
+    uint32_t u32Cnt;
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if ((IS_TIMERA_INSTANCE(TMRAx)) && (NULL != pi32Pos))
+    {
+        /* Retry when an index pulse was handled while reading */
+        do
+        {
+            u32Cnt = m_stcTimeraEnc.u32IndexCnt;
+            *pi32Pos = m_stcTimeraEnc.i32IndexPos;
+        } while (u32Cnt != m_stcTimeraEnc.u32IndexCnt);
+
+        if (NULL != pu32Cnt)
+        {
+            *pu32Cnt = u32Cnt;
+        }
+
+        enRet = (0ul != u32Cnt) ? Ok : ErrorNotReady;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Estimate the encoder speed.
+ * @param  [in] TMRAx                   Pointer to TimerA instance register base
+ *         This parameter can be one of the following values:
+ *           @arg M0P_TMRA:             TimerA unit 1 instance register base
+ * @param  [in] u32Now                  Current time stamp, in ticks of u32TickFreq
+ * @retval Speed in counts per second, positive when A leads B.
+ * @note   Call at the speed loop rate. The speed is the count difference
+ *         over a window divided by its duration from u32Now (M method). A
+ *         window closes once it holds u32MinCount counts or lasts
+ *         u32MaxWindow ticks: at high speed every call closes a window, at
+ *         low speed the window stretches over several calls, so the count
+ *         quantization stays below 1/u32MinCount. Between windows the last
+ *         speed is returned.
+ * @note   The window ends are the calls, not the encoder edges: an edge is
+ *         seen up to one calling period late at either end. The relative
+ *         error is up to the calling period plus one tick, divided by the
+ *         window duration, so slow speeds are resolved with long windows.
+ *         Edge times are not captured, the TimerA counter counts the edges.
+ */
+int32_t TIMERA_ENC_GetSpeed(M0P_TMRA_TypeDef *TMRAx, uint32_t u32Now)
+{
+    int32_t i32Pos;
+    int32_t i32Delta;
+    uint32_t u32Abs;
+    uint32_t u32Dt;
+    stc_timera_enc_ctx_t *pstcCtx = &m_stcTimeraEnc;
+
+    i32Pos = TIMERA_ENC_GetPosition(TMRAx);
+    if (0u == pstcCtx->u8WinValid)
+    {
+        pstcCtx->u8WinValid = 1u;
+    }
+    else
+    {
+        i32Delta = (int32_t)((uint32_t)i32Pos - (uint32_t)pstcCtx->i32WinPos);
+        u32Abs = (i32Delta < 0) ? (uint32_t)(-i32Delta) : (uint32_t)i32Delta;
+        u32Dt = u32Now - pstcCtx->u32WinTime;
+
+        if ((0ul == u32Dt) || ((u32Abs < pstcCtx->u32MinCount) && (u32Dt < pstcCtx->u32MaxWindow)))
+        {
+            /* Window still open */
+            i32Pos = pstcCtx->i32WinPos;
+            u32Now = pstcCtx->u32WinTime;
+        }
+        else
+        {
+            pstcCtx->i32Speed = (int32_t)(((int64_t)i32Delta * (int64_t)pstcCtx->u32TickFreq) / (int64_t)u32Dt);
+        }
+    }
+
+    pstcCtx->i32WinPos = i32Pos;
+    pstcCtx->u32WinTime = u32Now;
+
+    return pstcCtx->i32Speed;
+}
+
+/**
+ * @brief  TimerA encoder interrupt handler.
+ * @param  [in] TMRAx                   Pointer to TimerA instance register base
+ *         This parameter can be one of the following values:
+ *           @arg M0P_TMRA:             TimerA unit 1 instance register base
+ * @retval None
+ * @note   Call from the overflow, underflow and index capture interrupt
+ *         callbacks.
+ * @note   A flag is cleared and accounted with interrupts masked, so a
+ *         TIMERA_ENC_GetPosition() from a higher priority handler never sees
+ *         the wrap twice(flag still set) or not at all(flag already clear).
+ */
+void TIMERA_ENC_IrqHandler(M0P_TMRA_TypeDef *TMRAx)
+{
+    uint16_t u16Cap;
+    uint16_t u16CapFlag;
+    int32_t i32Pos;
+    uint32_t u32Primask;
+
+    u32Primask = __get_PRIMASK();
+    __disable_irq();
+    if (Set == TIMERA_GetFlag(TMRAx, TIMERA_FLAG_OVF))
+    {
+        TIMERA_ClearFlag(TMRAx, TIMERA_FLAG_OVF);
+        m_stcTimeraEnc.i32High++;
+    }
+
+    if (Set == TIMERA_GetFlag(TMRAx, TIMERA_FLAG_UDF))
+    {
+        TIMERA_ClearFlag(TMRAx, TIMERA_FLAG_UDF);
+        m_stcTimeraEnc.i32High--;
+    }
+    __set_PRIMASK(u32Primask);
+
+    if (TIMERA_ENC_INDEX_NONE != m_stcTimeraEnc.u8IndexCh)
+    {
+        u16CapFlag = (uint16_t)(TIMERA_FLAG_CMP1 << m_stcTimeraEnc.u8IndexCh);
+        if (Set == TIMERA_GetFlag(TMRAx, u16CapFlag))
+        {
+            u16Cap = TIMERA_IC_GetCapture(TMRAx, m_stcTimeraEnc.u8IndexCh);
+            TIMERA_ClearFlag(TMRAx, u16CapFlag);
+
+            /* Step back from the current position by the counts moved since
+               the capture, which also covers a wrap in between */
+            i32Pos = TIMERA_ENC_GetPosition(TMRAx);
+            m_stcTimeraEnc.i32IndexPos = i32Pos - (int32_t)(int16_t)(uint16_t)((uint16_t)i32Pos - u16Cap);
+            m_stcTimeraEnc.u32IndexCnt++;
+        }
+    }
+}
+
+#if (DDL_DMA_ENABLE == DDL_ON)
+/**
+ * @brief  Play a table of compare values on a PWM channel, one per period.
+ * @param  [in] TMRAx                   Pointer to TimerA instance register base
+ *         This parameter can be one of the following values:
+ *           @arg M0P_TMRA:             TimerA unit 1 instance register base
+ * @param  [in] pstcCfg                 Pointer to a @ref stc_timera_wave_cfg_t structure
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Waveform started
+ *           - ErrorInvalidParameter: Invalid parameter
+ * @note   Entry 0 is written at once, then the DMA channel triggered by the
+ *         TimerA overflow event writes the next entry after every period.
+ *         With enLoop the channel reloads a descriptor linked to itself at
+ *         the end of the table, so the waveform repeats without CPU load.
+ * @note   The PWM channel is set up beforehand with TIMERA_OC_Init(), and
+ *         the DMA unit is clocked and enabled with DMA_Cmd(). When the cache
+ *         of CH1 is enabled the table feeds CMPAR2, so each value takes
+ *         effect at the cache transmit of the following period. One-shot
+ *         completion is signalled by DMA_FLAG_TC of u8DmaCh.
+ * @note   Use one DMA channel per PWM channel to stream both channels. The
+ *         table must stay valid while the waveform is playing.
+ */
+en_result_t TIMERA_WAVE_Start(M0P_TMRA_TypeDef *TMRAx,
+                              const stc_timera_wave_cfg_t *pstcCfg)
+{
+    __IO uint16_t *TMRA_CMPAR;
+    stc_dma_ch_cfg_t stcDmaCfg;
+    stc_dma_llp_descriptor_t *pstcDesc;
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if ((IS_TIMERA_INSTANCE(TMRAx)) && (NULL != pstcCfg) &&                    \
+        (NULL != pstcCfg->pu16Table) && (0u != pstcCfg->u16Len) &&              \
+        (pstcCfg->u16Len <= TIMERA_WAVE_LEN_MAX) &&                             \
+        (pstcCfg->u8DmaCh < TIMERA_WAVE_DMA_CH_NUM))
+    {
+        /* Check parameters */
+        DDL_ASSERT(IS_TIMERA_CHANNEL(pstcCfg->u8Channel));
+        DDL_ASSERT(IS_FUNCTIONAL_STATE(pstcCfg->enLoop));
+
+        DMA_ChannelDisable(pstcCfg->u8DmaCh);
+
+        TMRA_CMPAR = (__IO uint16_t *)TMRA_CMPARx(TMRAx, pstcCfg->u8Channel);
+        if ((TIMERA_CHANNEL_CH1 == pstcCfg->u8Channel) &&
+            (0u != READ_REG16_BIT(TMRAx->BCONR, TMRA_BCONR_BEN)))
+        {
+            /* CMPAR2 is the cache of CMPAR1 */
+            TMRA_CMPAR = (__IO uint16_t *)TMRA_CMPARx(TMRAx, TIMERA_CHANNEL_CH2);
+        }
+        WRITE_REG16(*TMRA_CMPAR, pstcCfg->pu16Table[0u]);
+
+        if (pstcCfg->u16Len > 1u)
+        {
+            /* One 16-bit compare value per overflow event */
+            stcDmaCfg.u32DataWidth   = DMA_DATAWIDTH_16BIT;
+            stcDmaCfg.u32BlockSize   = 1ul;
+            stcDmaCfg.u32TransferCnt = (uint32_t)pstcCfg->u16Len - 1ul;
+            stcDmaCfg.u32SrcAddr     = (uint32_t)(&pstcCfg->pu16Table[1u]);
+            stcDmaCfg.u32DesAddr     = (uint32_t)TMRA_CMPAR;
+            stcDmaCfg.u32SrcInc      = DMA_SRCADDRINC_INC;
+            stcDmaCfg.u32DesInc      = DMA_DESADDRINC_FIX;
+            DMA_ChannelCfg(pstcCfg->u8DmaCh, &stcDmaCfg);
+            /* Plain linear transfer, no repeat or non-sequence */
+            DMA_RptNSeqCmd(pstcCfg->u8DmaCh, Disable);
+
+            if (Enable == pstcCfg->enLoop)
+            {
+                /* The whole table, linked to itself */
+                pstcDesc = &m_astcTimeraWaveDesc[pstcCfg->u8DmaCh];
+                stcDmaCfg.u32TransferCnt = pstcCfg->u16Len;
+                stcDmaCfg.u32SrcAddr     = (uint32_t)(&pstcCfg->pu16Table[0u]);
+                DMA_LlpDescInit(pstcDesc, &stcDmaCfg, DMA_LLP_WAIT, pstcDesc);
+                DMA_LlpInit(pstcCfg->u8DmaCh, DMA_LLP_WAIT, (uint32_t)pstcDesc);
+            }
+            else
+            {
+                DMA_LlpCmd(pstcCfg->u8DmaCh, Disable);
+            }
+
+            DMA_SetTriggerSrc(pstcCfg->u8DmaCh, EVT_TMRA_OVF);
+            DMA_ClearCplFlag(pstcCfg->u8DmaCh, DMA_FLAG_TC);
+            DMA_ChannelEnable(pstcCfg->u8DmaCh);
+        }
+
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Stop a waveform started by TIMERA_WAVE_Start().
+ * @param  [in] TMRAx                   Pointer to TimerA instance register base
+ *         This parameter can be one of the following values:
+ *           @arg M0P_TMRA:             TimerA unit 1 instance register base
+ * @param  [in] u8DmaCh                 DMA channel playing the waveform
+ * @retval None
+ * @note   The compare register keeps the last value written.
+ */
+void TIMERA_WAVE_Stop(M0P_TMRA_TypeDef *TMRAx, uint8_t u8DmaCh)
+{
+    /* Check parameters */
+    DDL_ASSERT(IS_TIMERA_INSTANCE(TMRAx));
+    DDL_ASSERT(u8DmaCh < TIMERA_WAVE_DMA_CH_NUM);
+
+    (void)TMRAx;
+    DMA_ChannelDisable(u8DmaCh);
+    DMA_ClearCplFlag(u8DmaCh, DMA_FLAG_TC);
+}
+#endif /* DDL_DMA_ENABLE */
+
 /**
  * @}
  */
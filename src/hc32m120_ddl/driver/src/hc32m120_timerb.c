@@ -55,6 +55,7 @@
  ******************************************************************************/
 #include "hc32m120_timerb.h"
 #include "hc32m120_utility.h"
+#include "hc32m120_dma.h"
 
 /**
  * @addtogroup HC32M120_DDL_Driver
@@ -122,6 +123,32 @@
  * @}
  */
 
+/**
+ * @defgroup TIMERB_Cascade_Unit TIMERB Cascade Unit
+ * @{
+ */
+#define TIMERB_CASCADE_EVEN_UNIT(__ODD__)   ((M0P_TMRB1 == (__ODD__)) ? M0P_TMRB2 : M0P_TMRB4)
+/**
+ * @}
+ */
+
+/**
+ * @defgroup TIMERB_Meter TIMERB Capture Meter
+ * @{
+ */
+#define TIMERB_METER_LEN_MIN                (3u)                     /*!< One rising, falling and rising edge */
+#define TIMERB_METER_LEN_MAX                (1024u)                  /*!< First sample plus the DMA transfer count limit */
+#define TIMERB_METER_DMA_CH_NUM             (2u)                     /*!< Number of DMA channels */
+
+#define TIMERB_METER_EVT(__TMRBx__)                                            \
+(   (M0P_TMRB1 == (__TMRBx__)) ? EVT_TMRB_1_CMP :                             \
+    (M0P_TMRB2 == (__TMRBx__)) ? EVT_TMRB_2_CMP :                             \
+    (M0P_TMRB3 == (__TMRBx__)) ? EVT_TMRB_3_CMP : EVT_TMRB_4_CMP)
+
+/**
+ * @}
+ */
+
 /**
  * @defgroup TIMERB_Check_Parameters_Validity TIMERB Check Parameters Validity
  * @{
@@ -133,6 +160,10 @@
     (M0P_TMRB3 == (x))                          ||                             \
     (M0P_TMRB4 == (x)))
 
+#define IS_TIMERB_CASCADE_INSTANCE(x)                                          \
+(   (M0P_TMRB1 == (x))                          ||                             \
+    (M0P_TMRB3 == (x)))
+
 #define IS_TIMERB_CNT_DIRECTION(x)                                             \
 (   (TIMERB_CNT_UP == (x))                      ||                             \
     (TIMERB_CNT_DOWN == (x)))
@@ -248,6 +279,14 @@
 /*******************************************************************************
  * Local variable definitions ('static')
  ******************************************************************************/
+#if (DDL_DMA_ENABLE == DDL_ON)
+/* Per DMA channel: descriptor arming both edges, descriptor of the remaining samples */
+static stc_dma_llp_descriptor_t m_astcTimerbMeterDesc[TIMERB_METER_DMA_CH_NUM][2u];
+/* Per DMA channel: CCONR value capturing both edges */
+static uint16_t m_au16TimerbMeterCconr[TIMERB_METER_DMA_CH_NUM];
+/* Per DMA channel: a window is started and not aborted */
+static __IO uint8_t m_au8TimerbMeterRun[TIMERB_METER_DMA_CH_NUM];
+#endif /* DDL_DMA_ENABLE */
 
 /*******************************************************************************
  * Function implementation - global ('extern') and local ('static')
@@ -1482,6 +1521,386 @@ uint16_t TIMERB_OC_GetForceOutputPolarity(M0P_TMRB_TypeDef *TMRBx)
     return READ_REG16_BIT(TMRBx->PCONR, TMRB_PCONR_FORC);
 }
 
+/**
+ * @brief  Initialize an odd/even TimerB pair as one 32-bit up counter.
+ * @param  [in] TMRBx                   Pointer to the odd TimerB instance of the pair
+ *         This parameter can be one of the following values:
+ *           @arg M0P_TMRB1:            TimerB unit 1(low) and unit 2(high)
+ *           @arg M0P_TMRB3:            TimerB unit 3(low) and unit 4(high)
+ * @param  [in] pstcInit                Pointer to a @ref stc_timerb_cascade_init_t structure
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Initialize success
+ *           - ErrorInvalidParameter: TMRBx is not an odd instance or pstcInit = NULL
+ * @note   The odd unit counts the clock over the full 16-bit range and the
+ *         even unit counts its overflows, so no software overflow counting
+ *         is needed.
+ * @note   For 32-bit capture both units must latch on the same edge. Use
+ *         TIMERB_IC_EVT with TIMERB_SetTriggerSrc() selecting one event(e.g.
+ *         the EIRQ event of the input pin), or feed the signal to both
+ *         TIMB_<t>_PWM1 pins for the pin edge conditions.
+ */
+en_result_t TIMERB_CASCADE_Init(M0P_TMRB_TypeDef *TMRBx,
+                                const stc_timerb_cascade_init_t *pstcInit)
+{
+    M0P_TMRB_TypeDef *TMRB_EVEN;
+    stc_timerb_init_t stcInit;
+    stc_timerb_ic_init_t stcIcInit;
+    en_result_t enRet = ErrorInvalidParameter;
+
+    /* Check TMRBx instance and pstcInit */
+    if ((IS_TIMERB_CASCADE_INSTANCE(TMRBx)) && (NULL != pstcInit))
+    {
+        /* Check parameters */
+        DDL_ASSERT(IS_TIMERB_CLOCK_DIV(pstcInit->u16ClkDiv));
+        DDL_ASSERT(IS_TIMERB_IC_CAPTURE_CONDITION(pstcInit->u16CaptureCondition));
+        DDL_ASSERT(IS_TIMERB_IC_NOISE_FILTER_CLKDIV(pstcInit->u16NoiseFilterClkDiv));
+
+        TMRB_EVEN = TIMERB_CASCADE_EVEN_UNIT(TMRBx);
+        TIMERB_Stop(TMRBx);
+        TIMERB_Stop(TMRB_EVEN);
+
+        /* Low half-word: free-running sawtooth up counter */
+        (void)TIMERB_StructInit(&stcInit);
+        stcInit.u16ClkDiv = pstcInit->u16ClkDiv;
+        (void)TIMERB_Init(TMRBx, &stcInit);
+
+        /* High half-word: counts the overflows of the low half-word */
+        stcInit.u16ClkDiv = TIMERB_CLKDIV_DIV1;
+        stcInit.u16HwUpCondition = TIMERB_HWUP_OVERFLOW;
+        (void)TIMERB_Init(TMRB_EVEN, &stcInit);
+
+        if (TIMERB_IC_INVALID != pstcInit->u16CaptureCondition)
+        {
+            stcIcInit.u16CaptureCondition = pstcInit->u16CaptureCondition;
+            stcIcInit.u16NoiseFilterClkDiv = pstcInit->u16NoiseFilterClkDiv;
+            (void)TIMERB_IC_Init(TMRBx, &stcIcInit);
+            (void)TIMERB_IC_Init(TMRB_EVEN, &stcIcInit);
+        }
+
+        TIMERB_ClearFlag(TMRBx, TIMERB_FLAG_CMP);
+        TIMERB_ClearFlag(TMRB_EVEN, TIMERB_FLAG_CMP);
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Set the fields of structure stc_timerb_cascade_init_t to default values.
+ * @param  [out] pstcInit               Pointer to a @ref stc_timerb_cascade_init_t structure
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Initialize success
+ *           - ErrorInvalidParameter: pstcInit = NULL
+ */
+en_result_t TIMERB_CASCADE_StructInit(stc_timerb_cascade_init_t *pstcInit)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+
+    /* Check parameters */
+    if (NULL != pstcInit)
+    {
+        pstcInit->u16ClkDiv = TIMERB_CLKDIV_DIV1;
+        pstcInit->u16CaptureCondition = TIMERB_IC_INVALID;
+        pstcInit->u16NoiseFilterClkDiv = TIMERB_IC_NOFICLKDIV_NONE;
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Start the 32-bit cascade counter.
+ * @param  [in] TMRBx                   Pointer to the odd TimerB instance of the pair
+ *         This parameter can be one of the following values:
+ *           @arg M0P_TMRB1:            TimerB unit 1(low) and unit 2(high)
+ *           @arg M0P_TMRB3:            TimerB unit 3(low) and unit 4(high)
+ * @retval None
+ */
+void TIMERB_CASCADE_Start(M0P_TMRB_TypeDef *TMRBx)
+{
+    /* Check parameters */
+    DDL_ASSERT(IS_TIMERB_CASCADE_INSTANCE(TMRBx));
+
+    /* High half-word first, so that no carry is lost */
+    TIMERB_Start(TIMERB_CASCADE_EVEN_UNIT(TMRBx));
+    TIMERB_Start(TMRBx);
+}
+
+/**
+ * @brief  Stop the 32-bit cascade counter.
+ * @param  [in] TMRBx                   Pointer to the odd TimerB instance of the pair
+ *         This parameter can be one of the following values:
+ *           @arg M0P_TMRB1:            TimerB unit 1(low) and unit 2(high)
+ *           @arg M0P_TMRB3:            TimerB unit 3(low) and unit 4(high)
+ * @retval None
+ */
+void TIMERB_CASCADE_Stop(M0P_TMRB_TypeDef *TMRBx)
+{
+    /* Check parameters */
+    DDL_ASSERT(IS_TIMERB_CASCADE_INSTANCE(TMRBx));
+
+    TIMERB_Stop(TMRBx);
+    TIMERB_Stop(TIMERB_CASCADE_EVEN_UNIT(TMRBx));
+}
+
+/**
+ * @brief  Set the 32-bit cascade counter value.
+ * @param  [in] TMRBx                   Pointer to the odd TimerB instance of the pair
+ *         This parameter can be one of the following values:
+ *           @arg M0P_TMRB1:            TimerB unit 1(low) and unit 2(high)
+ *           @arg M0P_TMRB3:            TimerB unit 3(low) and unit 4(high)
+ * @param  [in] u32Value                Counter value
+ * @retval None
+ * @note   Call this function while the counter is stopped.
+ */
+void TIMERB_CASCADE_SetCounter(M0P_TMRB_TypeDef *TMRBx, uint32_t u32Value)
+{
+    /* Check parameters */
+    DDL_ASSERT(IS_TIMERB_CASCADE_INSTANCE(TMRBx));
+
+    TIMERB_SetCounter(TIMERB_CASCADE_EVEN_UNIT(TMRBx), (uint16_t)(u32Value >> 16u));
+    TIMERB_SetCounter(TMRBx, (uint16_t)u32Value);
+}
+
+/**
+ * @brief  Get the 32-bit cascade counter value.
+ * @param  [in] TMRBx                   Pointer to the odd TimerB instance of the pair
+ *         This parameter can be one of the following values:
+ *           @arg M0P_TMRB1:            TimerB unit 1(low) and unit 2(high)
+ *           @arg M0P_TMRB3:            TimerB unit 3(low) and unit 4(high)
+ * @retval Counter value
+ * @note   The high half-word is read again after the low one, and the read
+ *         is retried when a carry happened in between, so the result never
+ *         mixes halves from either side of a low half-word overflow.
+ */
+uint32_t TIMERB_CASCADE_GetCounter(M0P_TMRB_TypeDef *TMRBx)
+{
+    M0P_TMRB_TypeDef *TMRB_EVEN;
+    uint16_t u16High;
+    uint16_t u16Low;
+
+    /* Check parameters */
+    DDL_ASSERT(IS_TIMERB_CASCADE_INSTANCE(TMRBx));
+
+    TMRB_EVEN = TIMERB_CASCADE_EVEN_UNIT(TMRBx);
+    do
+    {
+        u16High = READ_REG16(TMRB_EVEN->CNTER);
+        u16Low = READ_REG16(TMRBx->CNTER);
+    } while (u16High != READ_REG16(TMRB_EVEN->CNTER));
+
+    return (((uint32_t)u16High << 16u) | (uint32_t)u16Low);
+}
+
+/**
+ * @brief  Get the latest 32-bit capture value of the cascade pair.
+ * @param  [in] TMRBx                   Pointer to the odd TimerB instance of the pair
+ *         This parameter can be one of the following values:
+ *           @arg M0P_TMRB1:            TimerB unit 1(low) and unit 2(high)
+ *           @arg M0P_TMRB3:            TimerB unit 3(low) and unit 4(high)
+ * @param  [out] pu32Value              Pointer to the captured counter value
+ * @retval An en_result_t enumeration value:
+ *           - Ok: A new value is captured since the last call
+ *           - ErrorNotReady: No capture since the last call
+ *           - ErrorInvalidParameter: TMRBx is not an odd instance or pu32Value = NULL
+ * @note   The time between two captures is their difference modulo 2^32,
+ *         so intervals up to 2^32 count clocks need no overflow handling.
+ */
+en_result_t TIMERB_CASCADE_GetCapture(M0P_TMRB_TypeDef *TMRBx,
+                                      uint32_t *pu32Value)
+{
+    M0P_TMRB_TypeDef *TMRB_EVEN;
+    uint16_t u16High;
+    uint16_t u16Low;
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if ((IS_TIMERB_CASCADE_INSTANCE(TMRBx)) && (NULL != pu32Value))
+    {
+        enRet = ErrorNotReady;
+        if (Set == TIMERB_GetFlag(TMRBx, TIMERB_FLAG_CMP))
+        {
+            TMRB_EVEN = TIMERB_CASCADE_EVEN_UNIT(TMRBx);
+            TIMERB_ClearFlag(TMRBx, TIMERB_FLAG_CMP);
+            TIMERB_ClearFlag(TMRB_EVEN, TIMERB_FLAG_CMP);
+
+            /* Retry when a new capture overwrote the pair in between */
+            do
+            {
+                u16Low = READ_REG16(TMRBx->CMPAR);
+                u16High = READ_REG16(TMRB_EVEN->CMPAR);
+            } while (u16Low != READ_REG16(TMRBx->CMPAR));
+
+            *pu32Value = ((uint32_t)u16High << 16u) | (uint32_t)u16Low;
+            enRet = Ok;
+        }
+    }
+
+    return enRet;
+}
+
+#if (DDL_DMA_ENABLE == DDL_ON)
+/**
+ * @brief  Start capturing a window of input edges into a buffer by DMA.
+ * @param  [in] TMRBx                   Pointer to TimerB instance register base
+ *         This parameter can be one of the following values:
+ *           @arg M0P_TMRB1:            TimerB unit 1 instance register base
+ *           @arg M0P_TMRB2:            TimerB unit 2 instance register base
+ *           @arg M0P_TMRB3:            TimerB unit 3 instance register base
+ *           @arg M0P_TMRB4:            TimerB unit 4 instance register base
+ * @param  [in] u8DmaCh                 DMA channel, DMA_CHANNEL_0 or DMA_CHANNEL_1
+ * @param  [out] pu16Buf                Buffer receiving the capture values
+ * @param  [in] u16Len                  Number of capture values, 3 ~ 1024
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Capture started
+ *           - ErrorInvalidParameter: Invalid parameter
+ * @note   The first sample is captured on the rising edge of TIMB_<t>_PWM1.
+ *         A chained DMA descriptor then switches the unit to both edges, so
+ *         the buffer alternates rising and falling edges without any
+ *         interrupt per edge.
+ * @note   TMRBx is set up beforehand as a free-running counter with
+ *         TIMERB_Init()(period 0xFFFF) and TIMERB_IC_Init() for the noise
+ *         filter, and started. The DMA unit is clocked and enabled with
+ *         DMA_Cmd(). The input period must be shorter than 65536 count
+ *         clocks.
+ */
+en_result_t TIMERB_METER_Start(M0P_TMRB_TypeDef *TMRBx, uint8_t u8DmaCh,
+                               uint16_t *pu16Buf, uint16_t u16Len)
+{
+    stc_dma_ch_cfg_t stcDmaCfg;
+    stc_dma_llp_descriptor_t *pstcDesc;
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if ((IS_TIMERB_INSTANCE(TMRBx)) && (NULL != pu16Buf) &&                    \
+        (u16Len >= TIMERB_METER_LEN_MIN) && (u16Len <= TIMERB_METER_LEN_MAX) && \
+        (u8DmaCh < TIMERB_METER_DMA_CH_NUM))
+    {
+        DMA_ChannelDisable(u8DmaCh);
+        m_au8TimerbMeterRun[u8DmaCh] = 0u;
+
+        /* Capture mode, rising edge first */
+        MODIFY_REG16(TMRBx->CCONR, (TMRB_CCONR_CAPMDA | TMRB_CCONR_HICP),
+                     (TIMERB_INPUT_CAPTURE | TIMERB_IC_RISING));
+        m_au16TimerbMeterCconr[u8DmaCh] = (uint16_t)(READ_REG16(TMRBx->CCONR) | TIMERB_IC_FALLING);
+        TIMERB_ClearFlag(TMRBx, TIMERB_FLAG_CMP);
+        TIMERB_EnableCmpMatchEvt(TMRBx);
+
+        /* The first sample, then run the next descriptor at once */
+        stcDmaCfg.u32DataWidth   = DMA_DATAWIDTH_16BIT;
+        stcDmaCfg.u32BlockSize   = 1ul;
+        stcDmaCfg.u32TransferCnt = 1ul;
+        stcDmaCfg.u32SrcAddr     = (uint32_t)(&TMRBx->CMPAR);
+        stcDmaCfg.u32DesAddr     = (uint32_t)(&pu16Buf[0u]);
+        stcDmaCfg.u32SrcInc      = DMA_SRCADDRINC_FIX;
+        stcDmaCfg.u32DesInc      = DMA_DESADDRINC_INC;
+        DMA_ChannelCfg(u8DmaCh, &stcDmaCfg);
+        DMA_RptNSeqCmd(u8DmaCh, Disable);
+
+        /* The remaining samples, end of the chain */
+        pstcDesc = &m_astcTimerbMeterDesc[u8DmaCh][1u];
+        stcDmaCfg.u32TransferCnt = (uint32_t)u16Len - 1ul;
+        stcDmaCfg.u32DesAddr     = (uint32_t)(&pu16Buf[1u]);
+        DMA_LlpDescInit(pstcDesc, &stcDmaCfg, DMA_LLP_WAIT, NULL);
+
+        /* Write the both-edges condition, then wait for the next capture */
+        stcDmaCfg.u32TransferCnt = 1ul;
+        stcDmaCfg.u32SrcAddr     = (uint32_t)(&m_au16TimerbMeterCconr[u8DmaCh]);
+        stcDmaCfg.u32DesAddr     = (uint32_t)(&TMRBx->CCONR);
+        stcDmaCfg.u32DesInc      = DMA_DESADDRINC_FIX;
+        DMA_LlpDescInit(&m_astcTimerbMeterDesc[u8DmaCh][0u], &stcDmaCfg, DMA_LLP_WAIT, pstcDesc);
+
+        DMA_LlpInit(u8DmaCh, DMA_LLP_RUN, (uint32_t)(&m_astcTimerbMeterDesc[u8DmaCh][0u]));
+        DMA_SetTriggerSrc(u8DmaCh, TIMERB_METER_EVT(TMRBx));
+        DMA_ClearCplFlag(u8DmaCh, DMA_FLAG_TC);
+        m_au8TimerbMeterRun[u8DmaCh] = 1u;
+        DMA_ChannelEnable(u8DmaCh);
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Abort a capture window started by TIMERB_METER_Start().
+ * @param  [in] TMRBx                   Pointer to TimerB instance register base
+ *         This parameter can be one of the following values:
+ *           @arg M0P_TMRB1:            TimerB unit 1 instance register base
+ *           @arg M0P_TMRB2:            TimerB unit 2 instance register base
+ *           @arg M0P_TMRB3:            TimerB unit 3 instance register base
+ *           @arg M0P_TMRB4:            TimerB unit 4 instance register base
+ * @param  [in] u8DmaCh                 DMA channel used by the capture window
+ * @retval None
+ */
+void TIMERB_METER_Stop(M0P_TMRB_TypeDef *TMRBx, uint8_t u8DmaCh)
+{
+    /* Check parameters */
+    DDL_ASSERT(IS_TIMERB_INSTANCE(TMRBx));
+    DDL_ASSERT(u8DmaCh < TIMERB_METER_DMA_CH_NUM);
+
+    DMA_ChannelDisable(u8DmaCh);
+    m_au8TimerbMeterRun[u8DmaCh] = 0u;
+    TIMERB_DisableCmpMatchEvt(TMRBx);
+}
+
+/**
+ * @brief  Compute frequency and duty from a completed capture window.
+ * @param  [in] u8DmaCh                 DMA channel used by the capture window
+ * @param  [in] pu16Buf                 Buffer passed to TIMERB_METER_Start()
+ * @param  [in] u16Len                  Length passed to TIMERB_METER_Start()
+ * @param  [in] u32CntClkFreq           TimerB count clock frequency in Hz
+ * @param  [out] pstcResult             Pointer to a @ref stc_timerb_meter_result_t structure
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Result computed
+ *           - ErrorNotReady: The window is still being captured, or was
+ *             aborted by TIMERB_METER_Stop()
+ *           - ErrorInvalidParameter: Invalid parameter or no input period
+ * @note   Averages over all whole periods of the window, from the first to
+ *         the last captured rising edge.
+ */
+en_result_t TIMERB_METER_Calc(uint8_t u8DmaCh, const uint16_t *pu16Buf,
+                              uint16_t u16Len, uint32_t u32CntClkFreq,
+                              stc_timerb_meter_result_t *pstcResult)
+{
+    uint32_t i;
+    uint32_t u32PeriodNum;
+    uint32_t u32Total = 0ul;
+    uint32_t u32High = 0ul;
+    uint64_t u64Freq;
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if ((NULL != pu16Buf) && (NULL != pstcResult) && (0ul != u32CntClkFreq) && \
+        (u16Len >= TIMERB_METER_LEN_MIN) && (u16Len <= TIMERB_METER_LEN_MAX) && \
+        (u8DmaCh < TIMERB_METER_DMA_CH_NUM))
+    {
+        enRet = ErrorNotReady;
+        /* The channel disables itself at the end of the chain, a window
+           aborted by TIMERB_METER_Stop() never completes */
+        if ((0u != m_au8TimerbMeterRun[u8DmaCh]) &&
+            (Disable == DMA_GetChannelState(u8DmaCh)))
+        {
+            enRet = ErrorInvalidParameter;
+            /* Even samples are rising edges, odd samples falling edges */
+            u32PeriodNum = ((uint32_t)u16Len - 1ul) / 2ul;
+            for (i = 0ul; i < u32PeriodNum; i++)
+            {
+                u32High  += (uint16_t)(pu16Buf[(2ul * i) + 1ul] - pu16Buf[2ul * i]);
+                u32Total += (uint16_t)(pu16Buf[(2ul * i) + 2ul] - pu16Buf[2ul * i]);
+            }
+
+            if (0ul != u32Total)
+            {
+                u64Freq = (((uint64_t)u32PeriodNum * u32CntClkFreq * 1000ull) + (u32Total / 2ul)) / u32Total;
+                pstcResult->u32Freq = (u64Freq > 0xFFFFFFFFull) ? 0xFFFFFFFFul : (uint32_t)u64Freq;
+                pstcResult->u16Duty = (uint16_t)((((uint64_t)u32High * 10000ull) + (u32Total / 2ul)) / u32Total);
+                pstcResult->u16PeriodNum = (uint16_t)u32PeriodNum;
+                enRet = Ok;
+            }
+        }
+    }
+
+    return enRet;
+}
+#endif /* DDL_DMA_ENABLE */
+
 /**
  * @}
  */
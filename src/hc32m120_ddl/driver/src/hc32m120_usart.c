@@ -55,6 +55,8 @@
  * Include files
  ******************************************************************************/
 #include "hc32m120_usart.h"
+#include "hc32m120_dma.h"
+#include "hc32m120_timerb.h"
 #include "hc32m120_utility.h"
 
 /**
@@ -166,6 +168,40 @@
  * @}
  */
 
+/**
+ * @defgroup USART_CLKSYNC_Transfer_Config USART CLKSYNC Transfer Configuration
+ * @{
+ */
+/* Frames written to TDR but not yet received: one in the shift register and one in TDR */
+#define USART_CLKSYNC_MAX_INFLIGHT              (2u)
+
+/* RDR byte address of the USART_DR register */
+#define USART_RDR_ADDR(USARTx)                  ((uint32_t)(&(USARTx)->DR) + 2ul)
+
+/* TDR byte address of the USART_DR register */
+#define USART_TDR_ADDR(USARTx)                  ((uint32_t)(&(USARTx)->DR))
+
+/* CLKSYNC handle state */
+#define USART_CLKSYNC_STATE_IDLE                (0u)
+#define USART_CLKSYNC_STATE_CPU                 (1u)
+#define USART_CLKSYNC_STATE_DMA                 (2u)
+/**
+ * @}
+ */
+
+/**
+ * @defgroup USART_Auto_Baud_Config USART Auto-baud Detection Configuration
+ * @{
+ */
+/* Allowed deviation of a sync edge interval: 1/(2^n) of the first interval */
+#define USART_AUTOBAUD_TOLERANCE_SHIFT          (2u)
+
+/* USART clock prescaler division: 1 << (PSC * 2) */
+#define USART_PRESCALER_MAX                     (3ul)
+/**
+ * @}
+ */
+
 /**
  * @}
  */
@@ -177,10 +213,45 @@
 /*******************************************************************************
  * Local function prototypes ('static')
  ******************************************************************************/
+/**
+ * @defgroup USART_Local_Functions USART Local Functions
+ * @{
+ */
+static void UsartClkSyncChipSelect(const stc_clksync_handle_t *pstcHandle,
+                                    en_functional_state_t enNewSta);
+static void UsartClkSyncStart(stc_clksync_handle_t *pstcHandle,
+                                const uint8_t *pu8TxData,
+                                uint8_t *pu8RxData,
+                                uint16_t u16Size,
+                                uint8_t u8State);
+static void UsartClkSyncFillTx(stc_clksync_handle_t *pstcHandle);
+static void UsartClkSyncDrainRx(stc_clksync_handle_t *pstcHandle);
+static void UsartClkSyncStop(stc_clksync_handle_t *pstcHandle);
+#if (DDL_TIMERB_ENABLE == DDL_ON)
+static void UsartAutoBaudStop(stc_usart_autobaud_handle_t *pstcHandle);
+#endif /* DDL_TIMERB_ENABLE */
+static stc_usart_err_stat_t* UsartGetErrStat(const M0P_USART_TypeDef *USARTx);
+
+/**
+ * @}
+ */
 
 /*******************************************************************************
  * Local variable definitions ('static')
  ******************************************************************************/
+/**
+ * @defgroup USART_Local_Variables USART Local Variables
+ * @{
+ */
+/* TX source of DMA transfer without TX buffer */
+static const uint8_t m_u8ClkSyncTxDummy = USART_CLKSYNC_DUMMY_DATA;
+
+/* Receive error statistics of USART unit 1~3 */
+static stc_usart_err_stat_t m_astcUsartErrStat[3];
+
+/**
+ * @}
+ */
 
 /*******************************************************************************
  * Function implementation - global ('extern') and local ('static')
@@ -1506,10 +1577,1048 @@ en_result_t USART_SetBaudrate(M0P_USART_TypeDef *USARTx,
     return enRet;
 }
 
+/**
+ * @brief  Initialize CLKSYNC transfer handle.
+ * @param  [out] pstcHandle             Pointer to a @ref stc_clksync_handle_t structure
+ * @param  [in] USARTx                  Pointer to USART instance register base
+ *         This parameter can be one of the following values:
+ *           @arg M0P_USART1:           USART unit 1 instance register base
+ *           @arg M0P_USART2:           USART unit 2 instance register base
+ *           @arg M0P_USART3:           USART unit 3 instance register base
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Initialize successfully
+ *           - ErrorInvalidParameter: USARTx is invalid instance or pstcHandle == NULL
+ * @note   The USART unit must be initialized by USART_ClkSyncInit() before.
+ *         Chip select/complete callback are cleared, DMA channel 1 for TX and
+ *         DMA channel 0 for RX are set by default.
+ */
+en_result_t USART_ClkSyncHandleInit(stc_clksync_handle_t *pstcHandle,
+                                    M0P_USART_TypeDef *USARTx)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if ((IS_USART_INSTANCE(USARTx)) && (NULL != pstcHandle))
+    {
+        pstcHandle->USARTx = USARTx;
+        pstcHandle->u8DmaTxCh = 1u;
+        pstcHandle->u8DmaRxCh = 0u;
+        pstcHandle->pfnChipSelect = NULL;
+        pstcHandle->pfnXferCplt = NULL;
+        pstcHandle->pu8TxBuf = NULL;
+        pstcHandle->pu8RxBuf = NULL;
+        pstcHandle->u16TxXferCount = 0u;
+        pstcHandle->u16RxXferCount = 0u;
+        pstcHandle->u16RxLostCount = 0u;
+        pstcHandle->enXferResult = Ok;
+        pstcHandle->u8Busy = USART_CLKSYNC_STATE_IDLE;
+        pstcHandle->u8DmaDummy = 0u;
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  CLKSYNC transmit and receive an amount of data in full-duplex mode (blocking).
+ * @param  [in] pstcHandle              Pointer to a @ref stc_clksync_handle_t structure
+ * @param  [in] pu8TxData               Pointer to data transmitted buffer, NULL: send USART_CLKSYNC_DUMMY_DATA
+ * @param  [out] pu8RxData              Pointer to data received buffer, NULL: discard received data
+ * @param  [in] u16Size                 Amount of frames
+ * @param  [in] u32Timeout              Timeout value(millisecond) without any frame received
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Transfer successfully
+ *           - ErrorInvalidParameter: pstcHandle == NULL, u16Size == 0 or u32Timeout == 0
+ *           - ErrorOperationInProgress: The handle is busy
+ *           - ErrorTimeout: Transfer timeout
+ *           - Error: Transfer completed, but u16RxLostCount frames were lost by RX overrun
+ * @note   Up to two frames are kept in flight, so the clock runs without gaps
+ *         between frames as long as the CPU keeps up.
+ */
+en_result_t USART_ClkSyncTransmitReceive(stc_clksync_handle_t *pstcHandle,
+                                            const uint8_t *pu8TxData,
+                                            uint8_t *pu8RxData,
+                                            uint16_t u16Size,
+                                            uint32_t u32Timeout)
+{
+    uint32_t u32TimeCount;
+    uint32_t u32TimeoutCount;
+    uint16_t u16RxRemain;
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if ((NULL != pstcHandle) && (0u != u16Size) && (0ul != u32Timeout))
+    {
+        DDL_ASSERT(IS_USART_INSTANCE(pstcHandle->USARTx));
+
+        if (USART_CLKSYNC_STATE_IDLE != pstcHandle->u8Busy)
+        {
+            enRet = ErrorOperationInProgress;
+        }
+        else
+        {
+            u32TimeoutCount = u32Timeout * (SystemCoreClock / 10ul / 1000ul);
+            u32TimeCount = 0ul;
+            enRet = Ok;
+
+            UsartClkSyncStart(pstcHandle, pu8TxData, pu8RxData, u16Size, USART_CLKSYNC_STATE_CPU);
+            SET_REG32_BIT(pstcHandle->USARTx->CR1, (USART_CR1_TE | USART_CR1_RE));
+
+            while (0u != pstcHandle->u16RxXferCount)
+            {
+                u16RxRemain = pstcHandle->u16RxXferCount;
+
+                UsartClkSyncFillTx(pstcHandle);
+                UsartClkSyncDrainRx(pstcHandle);
+
+                if (u16RxRemain != pstcHandle->u16RxXferCount)
+                {
+                    u32TimeCount = 0ul;
+                }
+                else
+                {
+                    u32TimeCount++;
+                    if (u32TimeCount > u32TimeoutCount)
+                    {
+                        enRet = ErrorTimeout;
+                        break;
+                    }
+                }
+            }
+
+            UsartClkSyncStop(pstcHandle);
+
+            if ((Ok == enRet) && (0u != pstcHandle->u16RxLostCount))
+            {
+                enRet = Error;
+            }
+
+            pstcHandle->enXferResult = enRet;
+        }
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  CLKSYNC transmit and receive an amount of data in full-duplex mode (non-blocking).
+ * @param  [in] pstcHandle              Pointer to a @ref stc_clksync_handle_t structure
+ * @param  [in] pu8TxData               Pointer to data transmitted buffer, NULL: send USART_CLKSYNC_DUMMY_DATA
+ * @param  [out] pu8RxData              Pointer to data received buffer, NULL: discard received data
+ * @param  [in] u16Size                 Amount of frames
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Transfer started
+ *           - ErrorInvalidParameter: pstcHandle == NULL or u16Size == 0
+ *           - ErrorOperationInProgress: The handle is busy
+ * @note   USART_ClkSyncIrqHandler() must be called in the RX and RX error IRQ
+ *         callbacks of the USART unit. Only the RX interrupt is used, so one
+ *         IRQ is taken per frame. Frames lost by RX overrun still complete the
+ *         transfer, they are reported by u16RxLostCount and enXferResult of
+ *         the handle.
+ */
+en_result_t USART_ClkSyncTransmitReceive_IT(stc_clksync_handle_t *pstcHandle,
+                                            const uint8_t *pu8TxData,
+                                            uint8_t *pu8RxData,
+                                            uint16_t u16Size)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if ((NULL != pstcHandle) && (0u != u16Size))
+    {
+        DDL_ASSERT(IS_USART_INSTANCE(pstcHandle->USARTx));
+
+        if (USART_CLKSYNC_STATE_IDLE != pstcHandle->u8Busy)
+        {
+            enRet = ErrorOperationInProgress;
+        }
+        else
+        {
+            UsartClkSyncStart(pstcHandle, pu8TxData, pu8RxData, u16Size, USART_CLKSYNC_STATE_CPU);
+            SET_REG32_BIT(pstcHandle->USARTx->CR1, (USART_CR1_TE | USART_CR1_RE));
+            UsartClkSyncFillTx(pstcHandle);
+            /* RX interrupt is enabled after TX is filled to avoid racing with the IRQ handler */
+            SET_REG32_BIT(pstcHandle->USARTx->CR1, USART_CR1_RIE);
+            enRet = Ok;
+        }
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  CLKSYNC interrupt transfer IRQ handler.
+ * @param  [in] pstcHandle              Pointer to a @ref stc_clksync_handle_t structure
+ * @retval None
+ * @note   Call this function in the RX and RX error IRQ callbacks of the USART unit.
+ *         In the DMA transfer it handles the RX error interrupt only.
+ */
+void USART_ClkSyncIrqHandler(stc_clksync_handle_t *pstcHandle)
+{
+    if (NULL != pstcHandle)
+    {
+        if (USART_CLKSYNC_STATE_CPU == pstcHandle->u8Busy)
+        {
+            /* RX overrun is accounted by UsartClkSyncDrainRx() */
+            UsartClkSyncDrainRx(pstcHandle);
+
+            if (0u == pstcHandle->u16RxXferCount)
+            {
+                pstcHandle->enXferResult = (0u != pstcHandle->u16RxLostCount) ? Error : Ok;
+                UsartClkSyncStop(pstcHandle);
+
+                if (NULL != pstcHandle->pfnXferCplt)
+                {
+                    pstcHandle->pfnXferCplt();
+                }
+            }
+            else
+            {
+                UsartClkSyncFillTx(pstcHandle);
+            }
+        }
+#if (DDL_DMA_ENABLE == DDL_ON)
+        else if (USART_CLKSYNC_STATE_DMA == pstcHandle->u8Busy)
+        {
+            /* The frame lost by RX overrun never triggers the RX channel,
+               which would wait for it forever: end the transfer here */
+            if (0ul != READ_REG32_BIT(pstcHandle->USARTx->SR, USART_SR_ORE))
+            {
+                USART_RxErrIrqHandler(pstcHandle->USARTx);
+
+                pstcHandle->u16RxLostCount++;
+                pstcHandle->enXferResult = Error;
+                UsartClkSyncStop(pstcHandle);
+
+                if (NULL != pstcHandle->pfnXferCplt)
+                {
+                    pstcHandle->pfnXferCplt();
+                }
+            }
+        }
+#endif /* DDL_DMA_ENABLE */
+        else
+        {
+            /* Idle */
+        }
+    }
+}
+
+#if (DDL_DMA_ENABLE == DDL_ON)
+/**
+ * @brief  CLKSYNC transmit and receive an amount of data in full-duplex mode by DMA.
+ * @param  [in] pstcHandle              Pointer to a @ref stc_clksync_handle_t structure
+ * @param  [in] pu8TxData               Pointer to data transmitted buffer, NULL: send USART_CLKSYNC_DUMMY_DATA
+ * @param  [out] pu8RxData              Pointer to data received buffer, NULL: discard received data
+ * @param  [in] u16Size                 Amount of frames, 1 ~ USART_CLKSYNC_DMA_MAX_SIZE
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Transfer started
+ *           - ErrorInvalidParameter: pstcHandle == NULL or u16Size is out of range
+ *           - ErrorOperationInProgress: The handle is busy
+ * @note   The function clocks of DMA and AOS must be enabled, DMA must be
+ *         enabled by DMA_Cmd() and USART_ClkSyncDmaIrqHandler() must be called
+ *         in the transfer complete IRQ callback of the RX DMA channel.
+ *         USART_ClkSyncIrqHandler() must be called in the RX error IRQ
+ *         callback of the USART unit: an RX overrun ends the transfer, both
+ *         channels are stopped, the device is released and pfnXferCplt is
+ *         called with enXferResult = Error. Leave the RX IRQ of the unit
+ *         disabled in NVIC, it would be taken per frame for nothing.
+ * @note   The DMA channels are triggered by the TI/RI events of the USART unit,
+ *         so the CPU does not touch any frame during the transfer.
+ */
+en_result_t USART_ClkSyncTransmitReceive_DMA(stc_clksync_handle_t *pstcHandle,
+                                            const uint8_t *pu8TxData,
+                                            uint8_t *pu8RxData,
+                                            uint16_t u16Size)
+{
+    stc_dma_ch_cfg_t stcDmaChCfg;
+    en_event_src_t enTxEvt;
+    en_event_src_t enRxEvt;
+    M0P_USART_TypeDef *USARTx;
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if ((NULL != pstcHandle) && (0u != u16Size) && (u16Size <= USART_CLKSYNC_DMA_MAX_SIZE))
+    {
+        DDL_ASSERT(IS_USART_INSTANCE(pstcHandle->USARTx));
+        DDL_ASSERT(pstcHandle->u8DmaTxCh != pstcHandle->u8DmaRxCh);
+
+        if (USART_CLKSYNC_STATE_IDLE != pstcHandle->u8Busy)
+        {
+            enRet = ErrorOperationInProgress;
+        }
+        else
+        {
+            USARTx = pstcHandle->USARTx;
+
+            if (M0P_USART1 == USARTx)
+            {
+                enTxEvt = EVT_USART_1_TI;
+                enRxEvt = EVT_USART_1_RI;
+            }
+            else if (M0P_USART2 == USARTx)
+            {
+                enTxEvt = EVT_USART_2_TI;
+                enRxEvt = EVT_USART_2_RI;
+            }
+            else
+            {
+                enTxEvt = EVT_USART_3_TI;
+                enRxEvt = EVT_USART_3_RI;
+            }
+
+            UsartClkSyncStart(pstcHandle, pu8TxData, pu8RxData, u16Size, USART_CLKSYNC_STATE_DMA);
+
+            /* RX channel: RDR -> buffer */
+            stcDmaChCfg.u32DataWidth = DMA_DATAWIDTH_8BIT;
+            stcDmaChCfg.u32BlockSize = 1ul;
+            stcDmaChCfg.u32TransferCnt = (uint32_t)u16Size;
+            stcDmaChCfg.u32SrcAddr = USART_RDR_ADDR(USARTx);
+            stcDmaChCfg.u32SrcInc = DMA_SRCADDRINC_FIX;
+            if (NULL != pu8RxData)
+            {
+                stcDmaChCfg.u32DesAddr = (uint32_t)pu8RxData;
+                stcDmaChCfg.u32DesInc = DMA_DESADDRINC_INC;
+            }
+            else
+            {
+                stcDmaChCfg.u32DesAddr = (uint32_t)&pstcHandle->u8DmaDummy;
+                stcDmaChCfg.u32DesInc = DMA_DESADDRINC_FIX;
+            }
+            DMA_ChannelCfg(pstcHandle->u8DmaRxCh, &stcDmaChCfg);
+            DMA_SetTriggerSrc(pstcHandle->u8DmaRxCh, enRxEvt);
+
+            /* TX channel: buffer -> TDR */
+            stcDmaChCfg.u32DesAddr = USART_TDR_ADDR(USARTx);
+            stcDmaChCfg.u32DesInc = DMA_DESADDRINC_FIX;
+            if (NULL != pu8TxData)
+            {
+                stcDmaChCfg.u32SrcAddr = (uint32_t)pu8TxData;
+                stcDmaChCfg.u32SrcInc = DMA_SRCADDRINC_INC;
+            }
+            else
+            {
+                stcDmaChCfg.u32SrcAddr = (uint32_t)&m_u8ClkSyncTxDummy;
+                stcDmaChCfg.u32SrcInc = DMA_SRCADDRINC_FIX;
+            }
+            DMA_ChannelCfg(pstcHandle->u8DmaTxCh, &stcDmaChCfg);
+            DMA_SetTriggerSrc(pstcHandle->u8DmaTxCh, enTxEvt);
+
+            DMA_ClearCplFlag(pstcHandle->u8DmaRxCh, DMA_FLAG_TC);
+            DMA_ClearCplFlag(pstcHandle->u8DmaTxCh, DMA_FLAG_TC);
+            DMA_CplIrqCmd(pstcHandle->u8DmaRxCh, DMA_IRQ_TC, Enable);
+            DMA_ChannelEnable(pstcHandle->u8DmaRxCh);
+            DMA_ChannelEnable(pstcHandle->u8DmaTxCh);
+
+            /* Enable RX before TX: enabling TX raises the first TI event.
+               RIE enables the RX error interrupt for RX overrun. */
+            SET_REG32_BIT(USARTx->CR1, (USART_CR1_RE | USART_CR1_RIE));
+            SET_REG32_BIT(USARTx->CR1, USART_CR1_TE);
+            enRet = Ok;
+        }
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  CLKSYNC DMA transfer complete IRQ handler.
+ * @param  [in] pstcHandle              Pointer to a @ref stc_clksync_handle_t structure
+ * @retval None
+ * @note   Call this function in the transfer complete IRQ callback of the RX DMA channel.
+ */
+void USART_ClkSyncDmaIrqHandler(stc_clksync_handle_t *pstcHandle)
+{
+    if ((NULL != pstcHandle) && (USART_CLKSYNC_STATE_DMA == pstcHandle->u8Busy))
+    {
+        if (Set == DMA_GetCplFlag(pstcHandle->u8DmaRxCh, DMA_FLAG_TC))
+        {
+            DMA_ClearCplFlag(pstcHandle->u8DmaRxCh, DMA_FLAG_TC);
+            DMA_ClearCplFlag(pstcHandle->u8DmaTxCh, DMA_FLAG_TC);
+
+            pstcHandle->u16TxXferCount = 0u;
+            pstcHandle->u16RxXferCount = 0u;
+            pstcHandle->enXferResult = Ok;
+            UsartClkSyncStop(pstcHandle);
+
+            if (NULL != pstcHandle->pfnXferCplt)
+            {
+                pstcHandle->pfnXferCplt();
+            }
+        }
+    }
+}
+#endif /* DDL_DMA_ENABLE */
+
+/**
+ * @brief  Abort the ongoing CLKSYNC interrupt or DMA transfer.
+ * @param  [in] pstcHandle              Pointer to a @ref stc_clksync_handle_t structure
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Abort successfully
+ *           - ErrorInvalidParameter: pstcHandle == NULL
+ * @note   The transfer complete callback is not called, enXferResult of the
+ *         handle is set to Error.
+ */
+en_result_t USART_ClkSyncAbort(stc_clksync_handle_t *pstcHandle)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if (NULL != pstcHandle)
+    {
+        if (USART_CLKSYNC_STATE_IDLE != pstcHandle->u8Busy)
+        {
+            pstcHandle->enXferResult = Error;
+            UsartClkSyncStop(pstcHandle);
+        }
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Get CLKSYNC transfer busy state.
+ * @param  [in] pstcHandle              Pointer to a @ref stc_clksync_handle_t structure
+ * @retval An en_functional_state_t enumeration value:
+ *           - Enable: Transfer is ongoing
+ *           - Disable: Transfer is completed or not started
+ */
+en_functional_state_t USART_ClkSyncGetBusyState(const stc_clksync_handle_t *pstcHandle)
+{
+    DDL_ASSERT(NULL != pstcHandle);
+
+    return ((USART_CLKSYNC_STATE_IDLE != pstcHandle->u8Busy) ? Enable : Disable);
+}
+
+/**
+ * @brief  Set USART baudrate from a measured bit time.
+ * @param  [in] USARTx                  Pointer to USART instance register base
+ *         This parameter can be one of the following values:
+ *           @arg M0P_USART1:           USART unit 1 instance register base
+ *           @arg M0P_USART2:           USART unit 2 instance register base
+ *           @arg M0P_USART3:           USART unit 3 instance register base
+ * @param  [in] u32Ticks                Timer ticks measured over u32Bits bit times
+ * @param  [in] u32Bits                 Bit times covered by u32Ticks
+ * @param  [in] u32TickClkDiv           Division of the measuring timer clock (SystemCoreClock / u32TickClkDiv)
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Set successfully
+ *           - ErrorInvalidParameter: USARTx is invalid instance, parameter is zero or DIV_Integer is out of range
+ * @note   The divisor is computed in integer from the measured time, without
+ *         going through a baudrate value. The smallest clock prescaler whose
+ *         DIV_Integer fits in USART_BRR is selected, so any timer (TimerA or
+ *         TimerB input capture) clocked from HCLK can be used for measurement.
+ *         The receiver is disabled while USART_PR and USART_BRR are written,
+ *         so the frame being received is dropped instead of being sampled
+ *         with a half-updated clock. USART_BRR holds DIV_Integer only on this
+ *         device (no fractional baudrate), so the whole register is rewritten.
+ */
+en_result_t USART_SetBaudrateByBitTime(M0P_USART_TypeDef *USARTx,
+                                        uint32_t u32Ticks,
+                                        uint32_t u32Bits,
+                                        uint32_t u32TickClkDiv)
+{
+    uint32_t u32Prescaler = 0ul;
+    uint32_t u32BitDiv;
+    uint32_t u32Clocks;
+    uint32_t u32Den;
+    uint32_t u32RxEn;
+    uint32_t DIV;
+    en_result_t enRet = ErrorInvalidParameter;
+
+    /* Check USARTx pointer and parameters */
+    if ((IS_USART_INSTANCE(USARTx)) && (0ul != u32Ticks) && \
+        (0ul != u32Bits) && (0ul != u32TickClkDiv) &&        \
+        (u32Ticks <= (0xFFFFFFFFul / u32TickClkDiv)))
+    {
+        if (USART_MODE_UART == READ_REG32_BIT(USARTx->CR1, USART_CR1_MS))
+        {
+            /* UART: one bit time = 8 * (2 - OVER8) * (DIV_Integer + 1) USART clocks */
+            u32BitDiv = READ_REG32_BIT(USARTx->CR1, USART_CR1_OVER8) ? 8ul : 16ul;
+        }
+        else
+        {
+            /* Clock Sync: one bit time = 4 * (DIV_Integer + 1) USART clocks */
+            u32BitDiv = 4ul;
+        }
+
+        /* Measured time in HCLK cycles */
+        u32Clocks = u32Ticks * u32TickClkDiv;
+
+        do
+        {
+            /* DIV_Integer + 1 = Clocks / (Bits * BitDiv * Prescaler), rounded */
+            u32Den = u32Bits * u32BitDiv * (1ul << (u32Prescaler * 2ul));
+            DIV = (u32Clocks + (u32Den / 2ul)) / u32Den;
+
+            if ((DIV >= 1ul) && (DIV <= 0x100ul))
+            {
+                u32RxEn = READ_REG32_BIT(USARTx->CR1, USART_CR1_RE);
+                CLEAR_REG32_BIT(USARTx->CR1, USART_CR1_RE);
+                MODIFY_REG32(USARTx->PR, USART_PR_PSC, u32Prescaler);
+                WRITE_REG32(USARTx->BRR, ((DIV - 1ul) << USART_BRR_DIV_INTEGER_POS));
+                SET_REG32_BIT(USARTx->CR1, u32RxEn);
+                enRet = Ok;
+            }
+            u32Prescaler++;
+        } while ((Ok != enRet) && (DIV > 0x100ul) && (u32Prescaler <= USART_PRESCALER_MAX));
+    }
+
+    return enRet;
+}
+
+#if (DDL_TIMERB_ENABLE == DDL_ON)
+/**
+ * @brief  Initialize auto-baud detection handle.
+ * @param  [out] pstcHandle             Pointer to a @ref stc_usart_autobaud_handle_t structure
+ * @param  [in] USARTx                  Pointer to USART instance register base
+ *         This parameter can be one of the following values:
+ *           @arg M0P_USART1:           USART unit 1 instance register base
+ *           @arg M0P_USART2:           USART unit 2 instance register base
+ *           @arg M0P_USART3:           USART unit 3 instance register base
+ * @param  [in] TMRBx                   Pointer to TimerB instance register base
+ *         This parameter can be one of the following values:
+ *           @arg M0P_TMRB1:            TimerB unit 1 instance register base
+ *           @arg M0P_TMRB2:            TimerB unit 2 instance register base
+ *           @arg M0P_TMRB3:            TimerB unit 3 instance register base
+ *           @arg M0P_TMRB4:            TimerB unit 4 instance register base
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Initialize successfully
+ *           - ErrorInvalidParameter: USARTx/TMRBx is invalid instance or pstcHandle == NULL
+ * @note   The TimerB unit must be initialized by TIMERB_Init() before:
+ *         sawtooth wave, count up, period value 0xFFFF and a clock division
+ *         that keeps 8 bit times of the lowest baudrate under 65536 ticks.
+ */
+en_result_t USART_AutoBaudHandleInit(stc_usart_autobaud_handle_t *pstcHandle,
+                                        M0P_USART_TypeDef *USARTx,
+                                        M0P_TMRB_TypeDef *TMRBx)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if ((IS_USART_INSTANCE(USARTx)) && (NULL != TMRBx) && (NULL != pstcHandle))
+    {
+        pstcHandle->USARTx = USARTx;
+        pstcHandle->TMRBx = TMRBx;
+        pstcHandle->pfnDetectCplt = NULL;
+        pstcHandle->u16FirstEdge = 0u;
+        pstcHandle->u16PrevEdge = 0u;
+        pstcHandle->u16RefInterval = 0u;
+        pstcHandle->u8EdgeCount = 0u;
+        pstcHandle->u8Busy = 0u;
+        pstcHandle->u32Baudrate = 0ul;
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Start auto-baud detection.
+ * @param  [in] pstcHandle              Pointer to a @ref stc_usart_autobaud_handle_t structure
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Start successfully
+ *           - ErrorInvalidParameter: pstcHandle == NULL
+ *           - ErrorOperationInProgress: Detection is ongoing
+ * @note   The RX pin must be routed to TIMB_<t>_PWM1 of the TimerB unit (by
+ *         GPIO_SetFunc() or a board connection) and the TimerB compare match
+ *         interrupt must be registered to call USART_AutoBaudIrqHandler().
+ *         The TimerB unit is switched to falling edge input capture and its
+ *         noise filter setting is kept.
+ */
+en_result_t USART_AutoBaudStart(stc_usart_autobaud_handle_t *pstcHandle)
+{
+    M0P_TMRB_TypeDef *TMRBx;
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if (NULL != pstcHandle)
+    {
+        if (0u != pstcHandle->u8Busy)
+        {
+            enRet = ErrorOperationInProgress;
+        }
+        else
+        {
+            TMRBx = pstcHandle->TMRBx;
+
+            pstcHandle->u8EdgeCount = 0u;
+            pstcHandle->u32Baudrate = 0ul;
+            pstcHandle->u8Busy = 1u;
+
+            TIMERB_Stop(TMRBx);
+            TIMERB_SetMode(TMRBx, TIMERB_INPUT_CAPTURE);
+            TIMERB_IC_SetCaptureCondition(TMRBx, TIMERB_IC_FALLING);
+            TIMERB_ClearFlag(TMRBx, TIMERB_FLAG_CMP);
+            TIMERB_IntCmd(TMRBx, TIMERB_IT_CMP, Enable);
+            TIMERB_Start(TMRBx);
+            enRet = Ok;
+        }
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Auto-baud detection TimerB capture interrupt handler.
+ * @param  [in] pstcHandle              Pointer to a @ref stc_usart_autobaud_handle_t structure
+ * @retval None
+ * @note   Call it in the TimerB compare match (capture) interrupt callback.
+ *         Each edge interval of the sync character must be within 1/4 of the
+ *         first one, otherwise detection restarts from the current edge, so
+ *         noise or other characters before the sync character are skipped.
+ *         The USART divisor is programmed on the fifth edge, before the stop
+ *         bit of the sync character.
+ */
+void USART_AutoBaudIrqHandler(stc_usart_autobaud_handle_t *pstcHandle)
+{
+    uint16_t u16Edge;
+    uint16_t u16Interval;
+    uint16_t u16Tolerance;
+    uint32_t u32TickClkDiv;
+    uint32_t u32Ticks;
+
+    if (NULL != pstcHandle)
+    {
+        if (Set == TIMERB_GetFlag(pstcHandle->TMRBx, TIMERB_FLAG_CMP))
+        {
+            TIMERB_ClearFlag(pstcHandle->TMRBx, TIMERB_FLAG_CMP);
+
+            if (0u != pstcHandle->u8Busy)
+            {
+                u16Edge = TIMERB_GetCompare(pstcHandle->TMRBx);
+                /* Modulo 2^16 difference handles one counter wrap */
+                u16Interval = (uint16_t)(u16Edge - pstcHandle->u16PrevEdge);
+
+                if (0u == pstcHandle->u8EdgeCount)
+                {
+                    pstcHandle->u16FirstEdge = u16Edge;
+                    pstcHandle->u8EdgeCount = 1u;
+                }
+                else if (1u == pstcHandle->u8EdgeCount)
+                {
+                    pstcHandle->u16RefInterval = u16Interval;
+                    pstcHandle->u8EdgeCount = 2u;
+                }
+                else
+                {
+                    u16Tolerance = pstcHandle->u16RefInterval >> USART_AUTOBAUD_TOLERANCE_SHIFT;
+
+                    if ((u16Interval < (pstcHandle->u16RefInterval - u16Tolerance)) || \
+                        (u16Interval > (pstcHandle->u16RefInterval + u16Tolerance)))
+                    {
+                        /* Not the sync character: resynchronize on this edge */
+                        pstcHandle->u16FirstEdge = u16Edge;
+                        pstcHandle->u8EdgeCount = 1u;
+                    }
+                    else
+                    {
+                        pstcHandle->u8EdgeCount++;
+                    }
+                }
+                pstcHandle->u16PrevEdge = u16Edge;
+
+                if (USART_AUTOBAUD_SYNC_EDGES == pstcHandle->u8EdgeCount)
+                {
+                    UsartAutoBaudStop(pstcHandle);
+
+                    /* Clock division of TimerB: 2^CKDIV */
+                    u32TickClkDiv = 1ul << ((uint32_t)TIMERB_GetClkDiv(pstcHandle->TMRBx) >> TMRB_BCSTR_CKDIV_POS);
+                    u32Ticks = (uint32_t)(uint16_t)(u16Edge - pstcHandle->u16FirstEdge);
+
+                    if (Ok == USART_SetBaudrateByBitTime(pstcHandle->USARTx,
+                                                         u32Ticks,
+                                                         USART_AUTOBAUD_SYNC_BITS,
+                                                         u32TickClkDiv))
+                    {
+                        pstcHandle->u32Baudrate = ((SystemCoreClock / u32TickClkDiv) * USART_AUTOBAUD_SYNC_BITS + \
+                                                   (u32Ticks / 2ul)) / u32Ticks;
+                    }
+
+                    if (NULL != pstcHandle->pfnDetectCplt)
+                    {
+                        pstcHandle->pfnDetectCplt();
+                    }
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief  Abort the ongoing auto-baud detection.
+ * @param  [in] pstcHandle              Pointer to a @ref stc_usart_autobaud_handle_t structure
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Abort successfully
+ *           - ErrorInvalidParameter: pstcHandle == NULL
+ * @note   The detection complete callback is not called.
+ */
+en_result_t USART_AutoBaudAbort(stc_usart_autobaud_handle_t *pstcHandle)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if (NULL != pstcHandle)
+    {
+        if (0u != pstcHandle->u8Busy)
+        {
+            UsartAutoBaudStop(pstcHandle);
+        }
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Get auto-baud detection busy state.
+ * @param  [in] pstcHandle              Pointer to a @ref stc_usart_autobaud_handle_t structure
+ * @retval An en_functional_state_t enumeration value:
+ *           - Enable: Detection is ongoing
+ *           - Disable: Detection is completed or not started
+ */
+en_functional_state_t USART_AutoBaudGetBusyState(const stc_usart_autobaud_handle_t *pstcHandle)
+{
+    DDL_ASSERT(NULL != pstcHandle);
+
+    return ((0u != pstcHandle->u8Busy) ? Enable : Disable);
+}
+#endif /* DDL_TIMERB_ENABLE */
+
+/**
+ * @brief  USART receive error IRQ handler.
+ * @param  [in] USARTx                  Pointer to USART instance register base
+ *         This parameter can be one of the following values:
+ *           @arg M0P_USART1:           USART unit 1 instance register base
+ *           @arg M0P_USART2:           USART unit 2 instance register base
+ *           @arg M0P_USART3:           USART unit 3 instance register base
+ * @retval None
+ * @note   Call this function in the RX error IRQ callback of the USART unit
+ *         (INT_USART_x_EI or UsartxRxErr_IrqHandler). PE/FE/ORE are counted,
+ *         a frame received with parity or framing error is discarded and
+ *         the error flags are cleared, which re-arms the receiver.
+ * @note   The driver does not hook this function into any interrupt. The
+ *         application registers the RX error IRQ, e.g. INTC_IrqRegistration()
+ *         with INT_USART_x_EI and a callback calling this function, and
+ *         enables USART_INT_RX. Without it no receive error is counted.
+ *         USART_ClkSyncIrqHandler() calls it for RX overrun itself.
+ */
+void USART_RxErrIrqHandler(M0P_USART_TypeDef *USARTx)
+{
+    uint32_t u32Status;
+    stc_usart_err_stat_t *pstcStat;
+
+    pstcStat = UsartGetErrStat(USARTx);
+
+    if (NULL != pstcStat)
+    {
+        u32Status = READ_REG32(USARTx->SR);
+
+        if (0ul != (u32Status & USART_SR_PE))
+        {
+            pstcStat->u32ParityErr++;
+        }
+
+        if (0ul != (u32Status & USART_SR_FE))
+        {
+            pstcStat->u32FramingErr++;
+        }
+
+        if (0ul != (u32Status & (USART_SR_PE | USART_SR_FE)))
+        {
+            /* Discard the corrupted frame */
+            if (0ul != (u32Status & USART_SR_RXNE))
+            {
+                (void)USART_RecData(USARTx);
+            }
+            pstcStat->u32DroppedBytes++;
+        }
+
+        if (0ul != (u32Status & USART_SR_ORE))
+        {
+            /* The frame following the unread one is lost */
+            pstcStat->u32OverrunErr++;
+            pstcStat->u32DroppedBytes++;
+        }
+
+        SET_REG32_BIT(USARTx->CR1, (USART_CR1_CPE | USART_CR1_CFE | USART_CR1_CORE));
+    }
+}
+
+/**
+ * @brief  Count a frame lost because the receive buffer of the application is full.
+ * @param  [in] USARTx                  Pointer to USART instance register base
+ *         This parameter can be one of the following values:
+ *           @arg M0P_USART1:           USART unit 1 instance register base
+ *           @arg M0P_USART2:           USART unit 2 instance register base
+ *           @arg M0P_USART3:           USART unit 3 instance register base
+ * @retval None
+ * @note   Call this function in the RX IRQ callback when the ring buffer
+ *         write fails, so all link errors are reported by USART_GetErrStat().
+ *         The driver has no receive buffer and never calls it itself.
+ */
+void USART_ErrStatRingOverflow(M0P_USART_TypeDef *USARTx)
+{
+    stc_usart_err_stat_t *pstcStat;
+
+    pstcStat = UsartGetErrStat(USARTx);
+
+    if (NULL != pstcStat)
+    {
+        pstcStat->u32RingOverflow++;
+    }
+}
+
+/**
+ * @brief  Get a snapshot of the USART receive error statistics.
+ * @param  [in] USARTx                  Pointer to USART instance register base
+ *         This parameter can be one of the following values:
+ *           @arg M0P_USART1:           USART unit 1 instance register base
+ *           @arg M0P_USART2:           USART unit 2 instance register base
+ *           @arg M0P_USART3:           USART unit 3 instance register base
+ * @param  [out] pstcStat               Pointer to a @ref stc_usart_err_stat_t structure
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Get successfully
+ *           - ErrorInvalidParameter: USARTx is invalid instance or pstcStat == NULL
+ * @note   Interrupts are masked while copying, so the counters of the
+ *         snapshot are consistent with each other.
+ * @note   The counters are only updated by USART_RxErrIrqHandler() and
+ *         USART_ErrStatRingOverflow() called by the application.
+ */
+en_result_t USART_GetErrStat(M0P_USART_TypeDef *USARTx,
+                                stc_usart_err_stat_t *pstcStat)
+{
+    uint32_t u32Primask;
+    const stc_usart_err_stat_t *pstcSrc;
+    en_result_t enRet = ErrorInvalidParameter;
+
+    pstcSrc = UsartGetErrStat(USARTx);
+
+    if ((NULL != pstcSrc) && (NULL != pstcStat))
+    {
+        u32Primask = __get_PRIMASK();
+        __disable_irq();
+        *pstcStat = *pstcSrc;
+        __set_PRIMASK(u32Primask);
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Clear the USART receive error statistics.
+ * @param  [in] USARTx                  Pointer to USART instance register base
+ *         This parameter can be one of the following values:
+ *           @arg M0P_USART1:           USART unit 1 instance register base
+ *           @arg M0P_USART2:           USART unit 2 instance register base
+ *           @arg M0P_USART3:           USART unit 3 instance register base
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Clear successfully
+ *           - ErrorInvalidParameter: USARTx is invalid instance
+ */
+en_result_t USART_ClearErrStat(M0P_USART_TypeDef *USARTx)
+{
+    uint32_t u32Primask;
+    stc_usart_err_stat_t *pstcStat;
+    en_result_t enRet = ErrorInvalidParameter;
+
+    pstcStat = UsartGetErrStat(USARTx);
+
+    if (NULL != pstcStat)
+    {
+        u32Primask = __get_PRIMASK();
+        __disable_irq();
+        pstcStat->u32ParityErr = 0ul;
+        pstcStat->u32FramingErr = 0ul;
+        pstcStat->u32OverrunErr = 0ul;
+        pstcStat->u32DroppedBytes = 0ul;
+        pstcStat->u32RingOverflow = 0ul;
+        __set_PRIMASK(u32Primask);
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
 /**
  * @}
  */
 
+/**
+ * @addtogroup USART_Local_Functions USART Local Functions
+ * @{
+ */
+
+/**
+ * @brief  Call the chip select function of the CLKSYNC handle.
+ * @param  [in] pstcHandle              Pointer to a @ref stc_clksync_handle_t structure
+ * @param  [in] enNewSta                Enable: select device, Disable: release device
+ * @retval None
+ */
+static void UsartClkSyncChipSelect(const stc_clksync_handle_t *pstcHandle,
+                                    en_functional_state_t enNewSta)
+{
+    if (NULL != pstcHandle->pfnChipSelect)
+    {
+        pstcHandle->pfnChipSelect(enNewSta);
+    }
+}
+
+/**
+ * @brief  Prepare the CLKSYNC handle for a new transfer and select the device.
+ * @param  [in] pstcHandle              Pointer to a @ref stc_clksync_handle_t structure
+ * @param  [in] pu8TxData               Pointer to data transmitted buffer
+ * @param  [out] pu8RxData              Pointer to data received buffer
+ * @param  [in] u16Size                 Amount of frames
+ * @param  [in] u8State                 USART_CLKSYNC_STATE_CPU or USART_CLKSYNC_STATE_DMA
+ * @retval None
+ */
+static void UsartClkSyncStart(stc_clksync_handle_t *pstcHandle,
+                                const uint8_t *pu8TxData,
+                                uint8_t *pu8RxData,
+                                uint16_t u16Size,
+                                uint8_t u8State)
+{
+    M0P_USART_TypeDef *USARTx = pstcHandle->USARTx;
+
+    pstcHandle->pu8TxBuf = pu8TxData;
+    pstcHandle->pu8RxBuf = pu8RxData;
+    pstcHandle->u16TxXferCount = u16Size;
+    pstcHandle->u16RxXferCount = u16Size;
+    pstcHandle->u16RxLostCount = 0u;
+    pstcHandle->enXferResult = ErrorOperationInProgress;
+    pstcHandle->u8Busy = u8State;
+
+    /* Disable TX/RX && interrupts and clear error flags */
+    CLEAR_REG32_BIT(USARTx->CR1, (USART_CR1_TE | USART_CR1_RE | USART_CR1_RIE | \
+                                  USART_CR1_TCIE | USART_CR1_TXEIE));
+    SET_REG32_BIT(USARTx->CR1, (USART_CR1_CPE | USART_CR1_CFE | USART_CR1_CORE));
+
+    UsartClkSyncChipSelect(pstcHandle, Enable);
+}
+
+/**
+ * @brief  Write TX frames while TDR is empty and less than USART_CLKSYNC_MAX_INFLIGHT frames are pending.
+ * @param  [in] pstcHandle              Pointer to a @ref stc_clksync_handle_t structure
+ * @retval None
+ */
+static void UsartClkSyncFillTx(stc_clksync_handle_t *pstcHandle)
+{
+    M0P_USART_TypeDef *USARTx = pstcHandle->USARTx;
+    uint16_t u16Data;
+
+    while ((0u != pstcHandle->u16TxXferCount) &&
+           ((uint16_t)(pstcHandle->u16RxXferCount - pstcHandle->u16TxXferCount) < USART_CLKSYNC_MAX_INFLIGHT) &&
+           (0ul != READ_REG32_BIT(USARTx->SR, USART_SR_TXE)))
+    {
+        if (NULL != pstcHandle->pu8TxBuf)
+        {
+            u16Data = (uint16_t)(*pstcHandle->pu8TxBuf++);
+        }
+        else
+        {
+            u16Data = (uint16_t)USART_CLKSYNC_DUMMY_DATA;
+        }
+
+        WRITE_REG32(USARTx->DR, (uint32_t)u16Data);
+        pstcHandle->u16TxXferCount--;
+    }
+}
+
+/**
+ * @brief  Read RX frame if RDR is full and account the frame lost by RX overrun.
+ * @param  [in] pstcHandle              Pointer to a @ref stc_clksync_handle_t structure
+ * @retval None
+ */
+static void UsartClkSyncDrainRx(stc_clksync_handle_t *pstcHandle)
+{
+    M0P_USART_TypeDef *USARTx = pstcHandle->USARTx;
+    uint8_t u8Data;
+
+    if ((0u != pstcHandle->u16RxXferCount) &&
+        (0ul != READ_REG32_BIT(USARTx->SR, USART_SR_RXNE)))
+    {
+        u8Data = (uint8_t)(READ_REG32(USARTx->DR) >> USART_DR_RDR_POS);
+
+        if (NULL != pstcHandle->pu8RxBuf)
+        {
+            *pstcHandle->pu8RxBuf++ = u8Data;
+        }
+
+        pstcHandle->u16RxXferCount--;
+    }
+
+    /* The frame following the one in RDR is lost: skip its slot so the transfer still completes */
+    if ((0u != pstcHandle->u16RxXferCount) &&
+        (0ul != READ_REG32_BIT(USARTx->SR, USART_SR_ORE)))
+    {
+        USART_RxErrIrqHandler(USARTx);
+
+        if (NULL != pstcHandle->pu8RxBuf)
+        {
+            pstcHandle->pu8RxBuf++;
+        }
+
+        pstcHandle->u16RxXferCount--;
+        pstcHandle->u16RxLostCount++;
+    }
+}
+
+/**
+ * @brief  Stop the CLKSYNC transfer and release the device.
+ * @param  [in] pstcHandle              Pointer to a @ref stc_clksync_handle_t structure
+ * @retval None
+ */
+static void UsartClkSyncStop(stc_clksync_handle_t *pstcHandle)
+{
+    CLEAR_REG32_BIT(pstcHandle->USARTx->CR1, (USART_CR1_TE | USART_CR1_RE | USART_CR1_RIE));
+
+#if (DDL_DMA_ENABLE == DDL_ON)
+    if (USART_CLKSYNC_STATE_DMA == pstcHandle->u8Busy)
+    {
+        DMA_CplIrqCmd(pstcHandle->u8DmaRxCh, DMA_IRQ_TC, Disable);
+        DMA_ChannelDisable(pstcHandle->u8DmaRxCh);
+        DMA_ChannelDisable(pstcHandle->u8DmaTxCh);
+    }
+#endif /* DDL_DMA_ENABLE */
+
+    UsartClkSyncChipSelect(pstcHandle, Disable);
+    pstcHandle->u8Busy = USART_CLKSYNC_STATE_IDLE;
+}
+
+#if (DDL_TIMERB_ENABLE == DDL_ON)
+/**
+ * @brief  Stop the TimerB capture of auto-baud detection.
+ * @param  [in] pstcHandle              Pointer to a @ref stc_usart_autobaud_handle_t structure
+ * @retval None
+ */
+static void UsartAutoBaudStop(stc_usart_autobaud_handle_t *pstcHandle)
+{
+    TIMERB_IntCmd(pstcHandle->TMRBx, TIMERB_IT_CMP, Disable);
+    TIMERB_Stop(pstcHandle->TMRBx);
+    TIMERB_ClearFlag(pstcHandle->TMRBx, TIMERB_FLAG_CMP);
+    pstcHandle->u8Busy = 0u;
+}
+#endif /* DDL_TIMERB_ENABLE */
+
+/**
+ * @brief  Get the receive error statistics of the USART unit.
+ * @param  [in] USARTx                  Pointer to USART instance register base
+ * @retval Pointer to the statistics, NULL if USARTx is invalid instance
+ */
+static stc_usart_err_stat_t* UsartGetErrStat(const M0P_USART_TypeDef *USARTx)
+{
+    stc_usart_err_stat_t *pstcStat = NULL;
+
+    if (M0P_USART1 == USARTx)
+    {
+        pstcStat = &m_astcUsartErrStat[0];
+    }
+    else if (M0P_USART2 == USARTx)
+    {
+        pstcStat = &m_astcUsartErrStat[1];
+    }
+    else if (M0P_USART3 == USARTx)
+    {
+        pstcStat = &m_astcUsartErrStat[2];
+    }
+
+    return pstcStat;
+}
+
 #endif /* DDL_USART_ENABLE */
 
 /**
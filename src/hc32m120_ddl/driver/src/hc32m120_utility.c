@@ -85,6 +85,7 @@
 /*******************************************************************************
  * Local function prototypes ('static')
  ******************************************************************************/
+static uint64_t SysTickCycleToUs(uint64_t u64Cycle);
 #if (DDL_PRINT_ENABLE == DDL_ON)
 static en_result_t SetUartBaudrate(M0P_USART_TypeDef *USARTx,
                                         uint32_t u32Baudrate);
@@ -100,6 +101,7 @@ static en_result_t SetUartBaudrate(M0P_USART_TypeDef *USARTx,
 
 static uint32_t u32TickStep = 0ul;
 __IO static uint32_t u32TickCount = 0ul;
+static __IO uint64_t u64TickPeriod = 0ull;
 
 /**
  * @}
@@ -198,6 +200,7 @@ __WEAKDEF void SysTick_Delay(uint32_t u32Delay)
 __WEAKDEF void SysTick_IncTick(void)
 {
     u32TickCount += u32TickStep;
+    u64TickPeriod++;
 }
 
 /**
@@ -232,6 +235,93 @@ __WEAKDEF void SysTick_Resume(void)
     SysTick->CTRL  |= SysTick_CTRL_TICKINT_Msk;
 }
 
+/**
+ * @brief Provides a monotonic timestamp in core clock cycles.
+ * @param None
+ * @retval Cycles counted since SysTick_Init(), 0 if SysTick is not initialized
+ * @note  Built from the SysTick periods counted by SysTick_IncTick() and the
+ *        current down-counter value. A wrap that is pending while interrupts
+ *        are masked is accounted for, so the value never steps backwards.
+ */
+__WEAKDEF uint64_t SysTick_GetCycle(void)
+{
+    uint64_t u64Period;
+    uint32_t u32Reload;
+    uint32_t u32Val;
+    uint32_t u32Pend;
+    uint64_t u64Cycle = 0ull;
+
+    if (u32TickStep != 0ul)
+    {
+        u32Reload = SysTick->LOAD + 1ul;
+        do
+        {
+            u64Period = u64TickPeriod;
+            u32Val = SysTick->VAL;
+            u32Pend = SCB->ICSR & SCB_ICSR_PENDSTSET_Msk;
+            if (0ul != u32Pend)
+            {
+                /* Counter wrapped but the tick is not serviced yet */
+                u32Val = SysTick->VAL;
+            }
+        } while ((uint32_t)u64Period != (uint32_t)u64TickPeriod);
+
+        if (0ul != u32Pend)
+        {
+            u64Period++;
+        }
+        u64Cycle = (u64Period * u32Reload) + (u32Reload - 1ul - u32Val);
+    }
+
+    return u64Cycle;
+}
+
+/**
+ * @brief Provides a monotonic timestamp in microsecond.
+ * @param None
+ * @retval Microseconds since SysTick_Init()
+ */
+__WEAKDEF uint64_t SysTick_GetMicros(void)
+{
+    return SysTickCycleToUs(SysTick_GetCycle());
+}
+
+/**
+ * @brief Provides the time elapsed since a cycle timestamp.
+ * @param [in] u64StartCycle            Timestamp returned by SysTick_GetCycle().
+ * @retval Elapsed microseconds, saturated to 0xFFFFFFFF
+ */
+__WEAKDEF uint32_t SysTick_GetElapsedUs(uint64_t u64StartCycle)
+{
+    uint64_t u64Us;
+
+    u64Us = SysTickCycleToUs(SysTick_GetCycle() - u64StartCycle);
+
+    return (u64Us > 0xFFFFFFFFull) ? 0xFFFFFFFFul : (uint32_t)u64Us;
+}
+
+/**
+ * @brief This function provides minimum delay (in microseconds).
+ * @param [in] u32Us                    Delay specifies the delay time.
+ * @retval None
+ * @note  SysTick must be initialized by SysTick_Init(), otherwise the
+ *        function returns at once.
+ */
+__WEAKDEF void SysTick_DelayUs(uint32_t u32Us)
+{
+    const uint64_t u64Start = SysTick_GetCycle();
+    uint64_t u64Wait;
+
+    if (u32TickStep != 0ul)
+    {
+        /* Round up to guarantee minimum wait */
+        u64Wait = (((uint64_t)u32Us * SystemCoreClock) + 999999ull) / 1000000ull;
+        while ((SysTick_GetCycle() - u64Start) < u64Wait)
+        {
+        }
+    }
+}
+
 #ifdef __DEBUG
 /**
  * @brief DDL assert error handle function
@@ -420,6 +510,20 @@ static en_result_t SetUartBaudrate(M0P_USART_TypeDef *USARTx,
 
 #endif /* DDL_PRINT_ENABLE */
 
+/**
+ * @brief  Convert core clock cycles to microseconds.
+ * @param  [in] u64Cycle                Core clock cycles
+ * @retval Microseconds
+ */
+static uint64_t SysTickCycleToUs(uint64_t u64Cycle)
+{
+    const uint32_t u32Clk = SystemCoreClock;
+
+    /* Split into seconds and remainder to avoid overflowing the product */
+    return ((u64Cycle / u32Clk) * 1000000ull) +
+           (((u64Cycle % u32Clk) * 1000000ull) / u32Clk);
+}
+
 /**
  * @}
  */
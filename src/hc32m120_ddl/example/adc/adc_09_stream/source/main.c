@@ -0,0 +1,430 @@
+/**
+ *******************************************************************************
+ * @file  adc/adc_09_stream/source/main.c
+ * @brief Main program of ADC stream for the Device Driver Library.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       agent           First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software is owned and published by:
+ * Huada Semiconductor Co., Ltd. ("HDSC").
+ *
+ * BY DOWNLOADING, INSTALLING OR USING THIS SOFTWARE, YOU AGREE TO BE BOUND
+ * BY ALL THE TERMS AND CONDITIONS OF THIS AGREEMENT.
+ *
+ * This software contains source code for use with HDSC
+ * components. This software is licensed by HDSC to be adapted only
+ * for use in systems utilizing HDSC components. HDSC shall not be
+ * responsible for misuse or illegal use of this software for devices not
+ * supported herein. HDSC is providing this software "AS IS" and will
+ * not be responsible for issues arising from incorrect user implementation
+ * of the software.
+ *
+ * Disclaimer:
+ * HDSC MAKES NO WARRANTY, EXPRESS OR IMPLIED, ARISING BY LAW OR OTHERWISE,
+ * REGARDING THE SOFTWARE (INCLUDING ANY ACCOMPANYING WRITTEN MATERIALS),
+ * ITS PERFORMANCE OR SUITABILITY FOR YOUR INTENDED USE, INCLUDING,
+ * WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, THE IMPLIED
+ * WARRANTY OF FITNESS FOR A PARTICULAR PURPOSE OR USE, AND THE IMPLIED
+ * WARRANTY OF NONINFRINGEMENT.
+ * HDSC SHALL HAVE NO LIABILITY (WHETHER IN CONTRACT, WARRANTY, TORT,
+ * NEGLIGENCE OR OTHERWISE) FOR ANY DAMAGES WHATSOEVER (INCLUDING, WITHOUT
+ * LIMITATION, DAMAGES FOR LOSS OF BUSINESS PROFITS, BUSINESS INTERRUPTION,
+ * LOSS OF BUSINESS INFORMATION, OR OTHER PECUNIARY LOSS) ARISING FROM USE OR
+ * INABILITY TO USE THE SOFTWARE, INCLUDING, WITHOUT LIMITATION, ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL OR CONSEQUENTIAL DAMAGES OR LOSS OF DATA,
+ * SAVINGS OR PROFITS,
+ * EVEN IF Disclaimer HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGES.
+ * YOU ASSUME ALL RESPONSIBILITIES FOR SELECTION OF THE SOFTWARE TO ACHIEVE YOUR
+ * INTENDED RESULTS, AND FOR THE INSTALLATION OF, USE OF, AND RESULTS OBTAINED
+ * FROM, THE SOFTWARE.
+ *
+ * This software may be replicated in part or whole for the licensed use,
+ * with the restriction that this Disclaimer and Copyright notice must be
+ * included with each copy of this software, whether used in part or whole,
+ * at all times.
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ddl.h"
+
+/**
+ * @addtogroup HC32M120_DDL_Examples
+ * @{
+ */
+
+/**
+ * @addtogroup ADC_Stream
+ * @{
+ */
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/* ADC channels definition for this example. */
+#define VAR_VOL_CHANNEL             (ADC_CH9)
+#define AUX_CHANNEL                 (ADC_CH10)
+#define ADC_SA_CHANNEL              (VAR_VOL_CHANNEL | AUX_CHANNEL)
+#define ADC_SA_CHANNEL_COUNT        (2u)
+
+/* Data register span of sequence A, from ADC_CH9 to ADC_CH10. */
+#define ADC_SA_DR_SPAN              (2u)
+
+/* ADC channel sampling time. */
+#define ADC_SAMPLE_TIME             ((uint8_t)30)
+
+/* ADC resolution definition. */
+#define ADC_RESOLUTION              (ADC_RESOLUTION_12B)
+
+/* TimerA overflow triggers one scan: HRC8MHz / 1000 = 8kHz. */
+#define TIMERA_UNIT1                (M0P_TMRA)
+#define TIMERA_UNIT1_PERIOD_VALUE   ((uint16_t)1000u)
+
+/* Scans per block, one block every 8ms. */
+#define STREAM_BLOCK_SCANS          (64u)
+
+/* DMA definition. */
+#define STREAM_DMA_CH               (DMA_CHANNEL_0)
+#define STREAM_DMA_TC_INT           (INT_DAM_1_TC0)
+#define STREAM_DMA_TC_IRQn          (Int008_IRQn)
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+static void AdcConfig(void);
+static void AdcClockConfig(void);
+static void AdcInitConfig(void);
+static void AdcChannelConfig(void);
+static void AdcStreamConfig(void);
+static void TimeraConfig(void);
+static void StreamBlockCallback(const uint16_t *pu16Block, uint16_t u16Scans);
+
+static void AdcSetChannelPinAnalogMode(uint16_t u16Channel);
+static void AdcSetPinAnalogMode(uint8_t u8PinNbr);
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+static uint16_t m_au16Ring[2u * STREAM_BLOCK_SCANS * ADC_SA_DR_SPAN];
+static uint16_t m_au16Demux[STREAM_BLOCK_SCANS * ADC_SA_CHANNEL_COUNT];
+
+/* Latest results, watch them in the debugger. */
+static __IO uint16_t m_u16VarVolAvg = 0u;
+static __IO uint16_t m_u16AuxAvg = 0u;
+static __IO uint32_t m_u32BlockCnt = 0ul;
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+
+/**
+ * @brief  Main function of adc_09_stream project
+ * @param  None
+ * @retval int32_t return value, if needed
+ */
+int32_t main(void)
+{
+    /* The system clock is set to HRC8HMz by default. */
+
+    /* Configures ADC. */
+    AdcConfig();
+
+    /* Configures TimerA, the trigger of the scans. */
+    TimeraConfig();
+
+    /***************** Configuration end, application start **************/
+
+    /* Start triggering. The CPU only runs once per block of 64 scans. */
+    TIMERA_Cmd(TIMERA_UNIT1, Enable);
+
+    while (1u)
+    {
+        ;
+    }
+}
+
+/**
+ * @brief  Block callback of the stream, called in the DMA IRQ every 64 scans.
+ * @param  [in]  pu16Block          The demultiplexed block.
+ * @param  [in]  u16Scans           Number of scans in the block.
+ * @retval None
+ */
+static void StreamBlockCallback(const uint16_t *pu16Block, uint16_t u16Scans)
+{
+    uint16_t i;
+    uint32_t u32VarVolSum = 0ul;
+    uint32_t u32AuxSum = 0ul;
+
+    /* Channels in ascending order: ADC_CH9 first, then ADC_CH10. */
+    for (i = 0u; i < u16Scans; i++)
+    {
+        u32VarVolSum += pu16Block[i];
+        u32AuxSum    += pu16Block[u16Scans + i];
+    }
+    m_u16VarVolAvg = (uint16_t)(u32VarVolSum / u16Scans);
+    m_u16AuxAvg    = (uint16_t)(u32AuxSum / u16Scans);
+
+    m_u32BlockCnt++;
+}
+
+/**
+ * @brief  DMA channel 0 transfer complete IRQ callback.
+ * @param  None
+ * @retval None
+ */
+void DmaTc0_IrqHandler(void)
+{
+    ADC_StreamDmaIrqHandler();
+}
+
+/**
+ * @brief  ADC configuration, including clock configuration, initial configuration,
+ *         channel configuration and stream configuration.
+ * @param  None
+ * @retval None
+ */
+static void AdcConfig(void)
+{
+    AdcClockConfig();
+    AdcInitConfig();
+    AdcChannelConfig();
+    AdcStreamConfig();
+}
+
+/**
+ * @brief  Configures ADC clock.
+ *         The clock of ADC: HRC8MHz / 1 = 8MHz.
+ * @param  None
+ * @retval None
+ */
+static void AdcClockConfig(void)
+{
+    CLK_SetADClkDiv(CLK_HCLK_DIV1);
+}
+
+/**
+ * @brief  Initializes ADC.
+ * @param  None
+ * @retval None
+ */
+static void AdcInitConfig(void)
+{
+    stc_adc_init_t stcInit;
+
+    /* Set a default value. */
+    ADC_StructInit(&stcInit);
+
+    /* User configurations. */
+    stcInit.u16ScanConvMode = ADC_MODE_SA_SINGLE;
+    stcInit.u16Resolution   = ADC_RESOLUTION;
+    stcInit.u8SampTime      = ADC_SAMPLE_TIME;
+
+    /* 1. Enable ADC peripheral. */
+    CLK_FcgPeriphClockCmd(CLK_FCG_ADC, Enable);
+
+    /* 2. Initializes ADC. */
+    ADC_Init(&stcInit);
+}
+
+/**
+ * @brief  Configures ADC channel(s).
+ * @param  None
+ * @retval None
+ */
+static void AdcChannelConfig(void)
+{
+    /* Set the ADC pin to analog mode. The stream adds the channels to
+       sequence A by itself. */
+    AdcSetChannelPinAnalogMode(ADC_SA_CHANNEL);
+}
+
+/**
+ * @brief  Configures the ADC stream.
+ * @param  None
+ * @retval None
+ */
+static void AdcStreamConfig(void)
+{
+    stc_adc_stream_cfg_t stcStreamCfg;
+    stc_irq_regi_config_t stcIrqRegiConf;
+
+    /* 1. Enable DMA and AOS. */
+    CLK_FcgPeriphClockCmd(CLK_FCG_DMA, Enable);
+    CLK_FcgPeriphClockCmd(CLK_FCG_AOS, Enable);
+    DMA_Cmd(Enable);
+
+    /* 2. Register the DMA transfer complete IRQ. */
+    stcIrqRegiConf.enIntSrc    = STREAM_DMA_TC_INT;
+    stcIrqRegiConf.enIRQn      = STREAM_DMA_TC_IRQn;
+    stcIrqRegiConf.pfnCallback = &DmaTc0_IrqHandler;
+    INTC_IrqRegistration(&stcIrqRegiConf);
+    NVIC_ClearPendingIRQ(stcIrqRegiConf.enIRQn);
+    NVIC_SetPriority(stcIrqRegiConf.enIRQn, DDL_IRQ_PRIORITY_03);
+    NVIC_EnableIRQ(stcIrqRegiConf.enIRQn);
+
+    /* 3. Each TimerA overflow starts one scan of sequence A. */
+    stcStreamCfg.u16Channel      = ADC_SA_CHANNEL;
+    stcStreamCfg.u16ScanConvMode = ADC_MODE_SA_SINGLE;
+    stcStreamCfg.enTrgEvent      = EVT_TMRA_OVF;
+    stcStreamCfg.u8DmaCh         = STREAM_DMA_CH;
+    stcStreamCfg.u16BlockScans   = STREAM_BLOCK_SCANS;
+    stcStreamCfg.pu16Ring        = m_au16Ring;
+    stcStreamCfg.pu16Demux       = m_au16Demux;
+    stcStreamCfg.pfnBlock        = &StreamBlockCallback;
+    ADC_StreamStart(&stcStreamCfg);
+}
+
+/**
+ * @brief  Configures TimerA as the 8kHz trigger of sequence A.
+ * @param  None
+ * @retval None
+ */
+static void TimeraConfig(void)
+{
+    stc_timera_init_t stcTimeraInit;
+
+    CLK_FcgPeriphClockCmd(CLK_FCG_TIMA, Enable);
+
+    TIMERA_StructInit(&stcTimeraInit);
+    stcTimeraInit.u16CountMode = TIMERA_SAWTOOTH_WAVE;
+    stcTimeraInit.u16ClkDiv    = TIMERA_CLKDIV_DIV1;
+    stcTimeraInit.u16PeriodVal = TIMERA_UNIT1_PERIOD_VALUE;
+    TIMERA_Init(TIMERA_UNIT1, &stcTimeraInit);
+}
+
+/**
+ * @brief  Set specified ADC pin to analog mode.
+ * @param  [in]  u16Channel         The ADC channels.
+ *                                  This parameter can be values of @ref ADC_Channels
+ * @retval None
+ */
+static void AdcSetChannelPinAnalogMode(uint16_t u16Channel)
+{
+    uint8_t u8PinNbr;
+
+    u8PinNbr    = 0u;
+    u16Channel &= ADC_CH_ALL;
+
+    while (u16Channel != 0u)
+    {
+        if (u16Channel & 0x1u)
+        {
+            AdcSetPinAnalogMode(u8PinNbr);
+        }
+
+        u16Channel >>= 1u;
+        u8PinNbr++;
+    }
+}
+
+/**
+ * @brief  Set specified ADC pin to analog mode.
+ * @param  [in]  u8PinNbr           The ADC pin number.
+ *                                  This parameter can be a value of @ref ADC_Pin_Number
+ * @retval None
+ */
+static void AdcSetPinAnalogMode(uint8_t u8PinNbr)
+{
+    uint8_t u8Port = GPIO_PORT_2;
+    uint8_t u8Pin  = GPIO_PIN_0;
+    uint8_t u8Flag = 1u;
+
+    switch (u8PinNbr)
+    {
+    case ADC_ANI0:
+        u8Port = GPIO_PORT_2;
+        u8Pin  = GPIO_PIN_0;
+        break;
+
+    case ADC_ANI1:
+        u8Port = GPIO_PORT_2;
+        u8Pin  = GPIO_PIN_1;
+        break;
+
+    case ADC_ANI2:
+        u8Port = GPIO_PORT_2;
+        u8Pin  = GPIO_PIN_2;
+        break;
+
+    case ADC_ANI3:
+        u8Port = GPIO_PORT_2;
+        u8Pin  = GPIO_PIN_3;
+        break;
+
+    case ADC_ANI4:
+        u8Port = GPIO_PORT_2;
+        u8Pin  = GPIO_PIN_4;
+        break;
+
+    case ADC_ANI5:
+        u8Port = GPIO_PORT_2;
+        u8Pin  = GPIO_PIN_5;
+        break;
+
+    case ADC_ANI6:
+        u8Port = GPIO_PORT_2;
+        u8Pin  = GPIO_PIN_6;
+        break;
+
+    case ADC_ANI7:
+        u8Port = GPIO_PORT_2;
+        u8Pin  = GPIO_PIN_7;
+        break;
+
+    case ADC_ANI8:
+        u8Port = GPIO_PORT_14;
+        u8Pin  = GPIO_PIN_7;
+        break;
+
+    case ADC_ANI9:
+        u8Port = GPIO_PORT_0;
+        u8Pin  = GPIO_PIN_0;
+        break;
+
+    case ADC_ANI10:
+        u8Port = GPIO_PORT_0;
+        u8Pin  = GPIO_PIN_1;
+        break;
+
+    case ADC_ANI11:
+        u8Port = GPIO_PORT_12;
+        u8Pin  = GPIO_PIN_0;
+        break;
+
+    default:
+        u8Flag = 0u;
+        break;
+    }
+
+    if (u8Flag != 0u)
+    {
+        GPIO_SetFunc(u8Port, u8Pin, GPIO_FUNC_1_ANIN);
+    }
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
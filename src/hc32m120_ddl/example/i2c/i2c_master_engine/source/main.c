@@ -0,0 +1,415 @@
+/**
+ *******************************************************************************
+ * @file  i2c/i2c_master_engine/source/main.c
+ * @brief Main program I2C master transaction engine for the Device Driver
+ *        Library.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       agent           First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software is owned and published by:
+ * Huada Semiconductor Co., Ltd. ("HDSC").
+ *
+ * BY DOWNLOADING, INSTALLING OR USING THIS SOFTWARE, YOU AGREE TO BE BOUND
+ * BY ALL THE TERMS AND CONDITIONS OF THIS AGREEMENT.
+ *
+ * This software contains source code for use with HDSC
+ * components. This software is licensed by HDSC to be adapted only
+ * for use in systems utilizing HDSC components. HDSC shall not be
+ * responsible for misuse or illegal use of this software for devices not
+ * supported herein. HDSC is providing this software "AS IS" and will
+ * not be responsible for issues arising from incorrect user implementation
+ * of the software.
+ *
+ * Disclaimer:
+ * HDSC MAKES NO WARRANTY, EXPRESS OR IMPLIED, ARISING BY LAW OR OTHERWISE,
+ * REGARDING THE SOFTWARE (INCLUDING ANY ACCOMPANYING WRITTEN MATERIALS),
+ * ITS PERFORMANCE OR SUITABILITY FOR YOUR INTENDED USE, INCLUDING,
+ * WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, THE IMPLIED
+ * WARRANTY OF FITNESS FOR A PARTICULAR PURPOSE OR USE, AND THE IMPLIED
+ * WARRANTY OF NONINFRINGEMENT.
+ * HDSC SHALL HAVE NO LIABILITY (WHETHER IN CONTRACT, WARRANTY, TORT,
+ * NEGLIGENCE OR OTHERWISE) FOR ANY DAMAGES WHATSOEVER (INCLUDING, WITHOUT
+ * LIMITATION, DAMAGES FOR LOSS OF BUSINESS PROFITS, BUSINESS INTERRUPTION,
+ * LOSS OF BUSINESS INFORMATION, OR OTHER PECUNIARY LOSS) ARISING FROM USE OR
+ * INABILITY TO USE THE SOFTWARE, INCLUDING, WITHOUT LIMITATION, ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL OR CONSEQUENTIAL DAMAGES OR LOSS OF DATA,
+ * SAVINGS OR PROFITS,
+ * EVEN IF Disclaimer HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGES.
+ * YOU ASSUME ALL RESPONSIBILITIES FOR SELECTION OF THE SOFTWARE TO ACHIEVE YOUR
+ * INTENDED RESULTS, AND FOR THE INSTALLATION OF, USE OF, AND RESULTS OBTAINED
+ * FROM, THE SOFTWARE.
+ *
+ * This software may be replicated in part or whole for the licensed use,
+ * with the restriction that this Disclaimer and Copyright notice must be
+ * included with each copy of this software, whether used in part or whole,
+ * at all times.
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ddl.h"
+
+/**
+ * @addtogroup HC32M120_DDL_Examples
+ * @{
+ */
+
+/**
+ * @addtogroup I2C_Master_Engine
+ * @{
+ */
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/* 7-bit address of the slave, such as the i2c_slave_irq example on another
+   board or a sensor with 8-bit register addresses. */
+#define SLAVE_ADDRESS                   (0x06u)
+
+/* Registers accessed by this example. */
+#define REG_CONFIG                      (0x01u)
+#define REG_DATA                        (0x10u)
+#define REG_DATA_LEN                    (8u)
+
+/* Timeouts in ticks of I2C_MasterTimeoutTick(), which is called every 1ms. */
+#define XFER_TIMEOUT_MS                 (10ul)
+
+/* Polling period of the data block. */
+#define POLL_PERIOD_MS                  (500ul)
+
+/* I2C pin definition. */
+#define I2C_SCL_PORT                    (GPIO_PORT_6)
+#define I2C_SCL_PIN                     (GPIO_PIN_0)
+#define I2C_SDA_PORT                    (GPIO_PORT_6)
+#define I2C_SDA_PIN                     (GPIO_PIN_1)
+
+#define I2C_BAUDRATE                    (400000ul)
+
+/* I2C interrupt definition. */
+#define I2C_EEI_IRQn                    (Int008_IRQn)
+#define I2C_EEI_SOURCE                  (INT_IIC_EEI)
+#define I2C_TXI_IRQn                    (Int020_IRQn)
+#define I2C_TXI_SOURCE                  (INT_IIC_TXI)
+#define I2C_RXI_IRQn                    (Int018_IRQn)
+#define I2C_RXI_SOURCE                  (INT_IIC_RXI)
+#define I2C_TEI_IRQn                    (Int016_IRQn)
+#define I2C_TEI_SOURCE                  (INT_IIC_TEI)
+
+/* LED definition. */
+#define LED_R_PORT                      (GPIO_PORT_12)
+#define LED_R_PIN                       (GPIO_PIN_0)
+#define LED_G_PORT                      (GPIO_PORT_7)
+#define LED_G_PIN                       (GPIO_PIN_0)
+#define LED_R_ON()                      GPIO_ResetPins(LED_R_PORT, LED_R_PIN)
+#define LED_G_TOGGLE()                  GPIO_TogglePins(LED_G_PORT, LED_G_PIN)
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+static void I2cConfig(void);
+static void I2cIrqConfig(void);
+static void I2cIrqCallback(void);
+static void I2cCpltCallback(en_result_t enResult);
+static en_result_t I2cWaitCplt(void);
+static void I2cRecover(void);
+static void LedConfig(void);
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+static __IO uint8_t m_u8XferDone = 0u;
+static __IO en_result_t m_enXferResult = Ok;
+
+static uint8_t m_au8Config[2u] = {REG_CONFIG, 0x5Au};
+static uint8_t m_u8ConfigRead = 0u;
+static uint8_t m_au8DataRead[REG_DATA_LEN];
+/* Register address followed by the data block. */
+static uint8_t m_au8DataWrite[1u + REG_DATA_LEN] = {REG_DATA,
+                                                    0x01u, 0x02u, 0x03u, 0x04u,
+                                                    0x05u, 0x06u, 0x07u, 0x08u};
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @brief  Main function of i2c_master_engine project
+ * @param  None
+ * @retval int32_t return value, if needed
+ */
+int32_t main(void)
+{
+    stc_i2c_master_xfer_t stcXfer;
+    uint8_t u8Reg = REG_CONFIG;
+    en_result_t enRet;
+
+    /* The system clock is set to HRC8MHz by default. */
+
+    /* Configures LED. */
+    LedConfig();
+
+    /* SysTick 1ms, drives the transaction timeout. */
+    (void)SysTick_Init(1000ul);
+
+    /* Configures I2C. */
+    I2cConfig();
+
+    /***************** Configuration end, application start **************/
+
+    /* 1. Address only transaction, checks the slave acknowledges. */
+    stcXfer.u8SlaveAdr = SLAVE_ADDRESS;
+    stcXfer.pu8TxBuf   = NULL;
+    stcXfer.u16TxLen   = 0u;
+    stcXfer.pu8RxBuf   = NULL;
+    stcXfer.u16RxLen   = 0u;
+    enRet = I2C_MasterXferStart(&stcXfer, XFER_TIMEOUT_MS, &I2cCpltCallback);
+    if (Ok == enRet)
+    {
+        enRet = I2cWaitCplt();
+    }
+
+    /* 2. Write the configuration register. */
+    if (Ok == enRet)
+    {
+        stcXfer.pu8TxBuf = m_au8Config;
+        stcXfer.u16TxLen = (uint16_t)sizeof(m_au8Config);
+        enRet = I2C_MasterXferStart(&stcXfer, XFER_TIMEOUT_MS, &I2cCpltCallback);
+        if (Ok == enRet)
+        {
+            enRet = I2cWaitCplt();
+        }
+    }
+
+    /* 3. Read it back: register address, repeated start, then one byte. */
+    if (Ok == enRet)
+    {
+        stcXfer.pu8TxBuf = &u8Reg;
+        stcXfer.u16TxLen = 1u;
+        stcXfer.pu8RxBuf = &m_u8ConfigRead;
+        stcXfer.u16RxLen = 1u;
+        enRet = I2C_MasterXferStart(&stcXfer, XFER_TIMEOUT_MS, &I2cCpltCallback);
+        if (Ok == enRet)
+        {
+            enRet = I2cWaitCplt();
+        }
+    }
+
+    if ((Ok != enRet) || (m_u8ConfigRead != m_au8Config[1u]))
+    {
+        /* Slave absent or not responding as expected. */
+        LED_R_ON();
+        I2cRecover();
+    }
+
+    while (1u)
+    {
+        /* 4. Write the data block, the CPU is free until the transaction completes. */
+        stcXfer.pu8TxBuf = m_au8DataWrite;
+        stcXfer.u16TxLen = (uint16_t)sizeof(m_au8DataWrite);
+        stcXfer.pu8RxBuf = NULL;
+        stcXfer.u16RxLen = 0u;
+        enRet = I2C_MasterXferStart(&stcXfer, XFER_TIMEOUT_MS, &I2cCpltCallback);
+        if (Ok == enRet)
+        {
+            enRet = I2cWaitCplt();
+        }
+
+        /* 5. Read it back. */
+        if (Ok == enRet)
+        {
+            stcXfer.pu8TxBuf = m_au8DataWrite;
+            stcXfer.u16TxLen = 1u;
+            stcXfer.pu8RxBuf = m_au8DataRead;
+            stcXfer.u16RxLen = REG_DATA_LEN;
+            enRet = I2C_MasterXferStart(&stcXfer, XFER_TIMEOUT_MS, &I2cCpltCallback);
+            if (Ok == enRet)
+            {
+                enRet = I2cWaitCplt();
+            }
+        }
+
+        if (Ok == enRet)
+        {
+            LED_G_TOGGLE();
+        }
+        else
+        {
+            LED_R_ON();
+            I2cRecover();
+        }
+
+        SysTick_Delay(POLL_PERIOD_MS);
+    }
+}
+
+/**
+ * @brief  SysTick interrupt callback function.
+ * @param  None
+ * @retval None
+ */
+void SysTick_IrqHandler(void)
+{
+    SysTick_IncTick();
+    I2C_MasterTimeoutTick();
+}
+
+/**
+ * @brief  I2C configuration.
+ * @param  None
+ * @retval None
+ */
+static void I2cConfig(void)
+{
+    stc_i2c_init_t stcI2cInit;
+    float32_t fErr;
+
+    /* 1. I2C pins. */
+    GPIO_SetFunc(I2C_SCL_PORT, I2C_SCL_PIN, GPIO_FUNC_6_I2C);
+    GPIO_SetFunc(I2C_SDA_PORT, I2C_SDA_PIN, GPIO_FUNC_6_I2C);
+
+    /* 2. Enable I2C peripheral clock. */
+    CLK_FcgPeriphClockCmd(CLK_FCG_I2C, Enable);
+
+    /* 3. 400kbps master. */
+    I2C_DeInit();
+    I2C_StructInit(&stcI2cInit);
+    stcI2cInit.u32Baudrate  = I2C_BAUDRATE;
+    stcI2cInit.u32I2cClkDiv = I2C_CLK_DIV1;
+    stcI2cInit.u32SclTime   = 5u;
+    I2C_Init(&stcI2cInit, &fErr);
+
+    /* 4. Configures IRQ, all of them are handled by the engine. */
+    I2cIrqConfig();
+
+    I2C_Cmd(Enable);
+}
+
+/**
+ * @brief  I2C interrupt configuration.
+ * @param  None
+ * @retval None
+ */
+static void I2cIrqConfig(void)
+{
+    stc_irq_regi_config_t stcIrqRegiCfg;
+
+    stcIrqRegiCfg.pfnCallback = &I2cIrqCallback;
+
+    stcIrqRegiCfg.enIRQn   = I2C_EEI_IRQn;
+    stcIrqRegiCfg.enIntSrc = I2C_EEI_SOURCE;
+    INTC_IrqRegistration(&stcIrqRegiCfg);
+    NVIC_ClearPendingIRQ(stcIrqRegiCfg.enIRQn);
+    NVIC_SetPriority(stcIrqRegiCfg.enIRQn, DDL_IRQ_PRIORITY_03);
+    NVIC_EnableIRQ(stcIrqRegiCfg.enIRQn);
+
+    stcIrqRegiCfg.enIRQn   = I2C_RXI_IRQn;
+    stcIrqRegiCfg.enIntSrc = I2C_RXI_SOURCE;
+    INTC_IrqRegistration(&stcIrqRegiCfg);
+    NVIC_ClearPendingIRQ(stcIrqRegiCfg.enIRQn);
+    NVIC_SetPriority(stcIrqRegiCfg.enIRQn, DDL_IRQ_PRIORITY_03);
+    NVIC_EnableIRQ(stcIrqRegiCfg.enIRQn);
+
+    stcIrqRegiCfg.enIRQn   = I2C_TXI_IRQn;
+    stcIrqRegiCfg.enIntSrc = I2C_TXI_SOURCE;
+    INTC_IrqRegistration(&stcIrqRegiCfg);
+    NVIC_ClearPendingIRQ(stcIrqRegiCfg.enIRQn);
+    NVIC_SetPriority(stcIrqRegiCfg.enIRQn, DDL_IRQ_PRIORITY_03);
+    NVIC_EnableIRQ(stcIrqRegiCfg.enIRQn);
+
+    stcIrqRegiCfg.enIRQn   = I2C_TEI_IRQn;
+    stcIrqRegiCfg.enIntSrc = I2C_TEI_SOURCE;
+    INTC_IrqRegistration(&stcIrqRegiCfg);
+    NVIC_ClearPendingIRQ(stcIrqRegiCfg.enIRQn);
+    NVIC_SetPriority(stcIrqRegiCfg.enIRQn, DDL_IRQ_PRIORITY_03);
+    NVIC_EnableIRQ(stcIrqRegiCfg.enIRQn);
+}
+
+/**
+ * @brief  I2C EEI/TXI/RXI/TEI interrupt callback function.
+ * @param  None
+ * @retval None
+ */
+static void I2cIrqCallback(void)
+{
+    I2C_MasterIrqHandler();
+}
+
+/**
+ * @brief  I2C transaction complete callback function.
+ * @param  [in] enResult            Ok, Error or ErrorTimeout
+ * @retval None
+ */
+static void I2cCpltCallback(en_result_t enResult)
+{
+    m_enXferResult = enResult;
+    m_u8XferDone = 1u;
+}
+
+/**
+ * @brief  Wait for the complete callback.
+ * @param  None
+ * @retval Result reported by the callback
+ * @note   The engine runs in the interrupts, other work can be done here.
+ *         The timeout of the transaction ends the wait.
+ */
+static en_result_t I2cWaitCplt(void)
+{
+    while (0u == m_u8XferDone)
+    {
+        ;
+    }
+    m_u8XferDone = 0u;
+
+    return m_enXferResult;
+}
+
+/**
+ * @brief  Release the bus after a failed transaction.
+ * @param  None
+ * @retval None
+ */
+static void I2cRecover(void)
+{
+    (void)I2C_MasterAbort();
+}
+
+/**
+ * @brief  Led configuration.
+ * @param  None
+ * @retval None
+ */
+static void LedConfig(void)
+{
+    stc_gpio_init_t stcGpioInit = {0u};
+
+    stcGpioInit.u16PinMode = PIN_MODE_OUT;
+    stcGpioInit.u16PinState = PIN_STATE_SET;
+    GPIO_Init(LED_G_PORT, LED_G_PIN, &stcGpioInit);
+    GPIO_Init(LED_R_PORT, LED_R_PIN, &stcGpioInit);
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -0,0 +1,259 @@
+/**
+ *******************************************************************************
+ * @file  timer0/timer0_timer_wheel/source/main.c
+ * @brief Main program TIMER0 software timer wheel for the Device Driver Library.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       agent           First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software is owned and published by:
+ * Huada Semiconductor Co., Ltd. ("HDSC").
+ *
+ * BY DOWNLOADING, INSTALLING OR USING THIS SOFTWARE, YOU AGREE TO BE BOUND
+ * BY ALL THE TERMS AND CONDITIONS OF THIS AGREEMENT.
+ *
+ * This software contains source code for use with HDSC
+ * components. This software is licensed by HDSC to be adapted only
+ * for use in systems utilizing HDSC components. HDSC shall not be
+ * responsible for misuse or illegal use of this software for devices not
+ * supported herein. HDSC is providing this software "AS IS" and will
+ * not be responsible for issues arising from incorrect user implementation
+ * of the software.
+ *
+ * Disclaimer:
+ * HDSC MAKES NO WARRANTY, EXPRESS OR IMPLIED, ARISING BY LAW OR OTHERWISE,
+ * REGARDING THE SOFTWARE (INCLUDING ANY ACCOMPANYING WRITTEN MATERIALS),
+ * ITS PERFORMANCE OR SUITABILITY FOR YOUR INTENDED USE, INCLUDING,
+ * WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, THE IMPLIED
+ * WARRANTY OF FITNESS FOR A PARTICULAR PURPOSE OR USE, AND THE IMPLIED
+ * WARRANTY OF NONINFRINGEMENT.
+ * HDSC SHALL HAVE NO LIABILITY (WHETHER IN CONTRACT, WARRANTY, TORT,
+ * NEGLIGENCE OR OTHERWISE) FOR ANY DAMAGES WHATSOEVER (INCLUDING, WITHOUT
+ * LIMITATION, DAMAGES FOR LOSS OF BUSINESS PROFITS, BUSINESS INTERRUPTION,
+ * LOSS OF BUSINESS INFORMATION, OR OTHER PECUNIARY LOSS) ARISING FROM USE OR
+ * INABILITY TO USE THE SOFTWARE, INCLUDING, WITHOUT LIMITATION, ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL OR CONSEQUENTIAL DAMAGES OR LOSS OF DATA,
+ * SAVINGS OR PROFITS,
+ * EVEN IF Disclaimer HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGES.
+ * YOU ASSUME ALL RESPONSIBILITIES FOR SELECTION OF THE SOFTWARE TO ACHIEVE YOUR
+ * INTENDED RESULTS, AND FOR THE INSTALLATION OF, USE OF, AND RESULTS OBTAINED
+ * FROM, THE SOFTWARE.
+ *
+ * This software may be replicated in part or whole for the licensed use,
+ * with the restriction that this Disclaimer and Copyright notice must be
+ * included with each copy of this software, whether used in part or whole,
+ * at all times.
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ddl.h"
+
+/**
+ * @addtogroup HC32M120_DDL_Examples
+ * @{
+ */
+
+/**
+ * @addtogroup Timer0_Timer_Wheel
+ * @{
+ */
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/* Define for RGB LED */
+#define LED_R_PORT              (GPIO_PORT_12)
+#define LED_B_PORT              (GPIO_PORT_3)
+#define LED_G_PORT              (GPIO_PORT_7)
+#define LED_R_PIN               (GPIO_PIN_0)
+#define LED_B_PIN               (GPIO_PIN_1)
+#define LED_G_PIN               (GPIO_PIN_0)
+#define LED_R_OFF()             (GPIO_SetPins(LED_R_PORT, LED_R_PIN))
+#define LED_B_ON()              (GPIO_ResetPins(LED_B_PORT, LED_B_PIN))
+#define LED_R_TOGGLE()          (GPIO_TogglePins(LED_R_PORT, LED_R_PIN))
+#define LED_G_TOGGLE()          (GPIO_TogglePins(LED_G_PORT, LED_G_PIN))
+
+/* TIMER0 interrupt source and number define */
+#define TIMER0_IRQn             (Int014_IRQn)
+#define TIMER0_SOURCE           (INT_TMR0_GCMP)
+
+/* HRC 8MHz divided by 256, one tick is 32us. */
+#define SWT_TICK_FREQ           (8000000ul / 256ul)
+#define SWT_MS_TO_TICKS(ms)     (((ms) * SWT_TICK_FREQ) / 1000ul)
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+static void Timer0Config(void);
+static void LedConfig(void);
+static void FastBlinkCallback(void);
+static void SlowBlinkCallback(void);
+static void TimeoutCallback(void);
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+/* Software timers, zero-initialized before their first use. */
+static stc_timer0_swt_t m_stcFastBlink = {NULL, NULL, 0ul, 0ul, NULL};
+static stc_timer0_swt_t m_stcSlowBlink = {NULL, NULL, 0ul, 0ul, NULL};
+static stc_timer0_swt_t m_stcTimeout   = {NULL, NULL, 0ul, 0ul, NULL};
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+
+/**
+ * @brief  TIMER0 compare IRQ callback
+ * @param  None
+ * @retval None
+ */
+static void Timer0CompareIrqCallback(void)
+{
+    TIMER0_SWT_IrqHandler();
+}
+
+/**
+ * @brief  Periodic software timer callback, toggles LED R every 100ms.
+ * @param  None
+ * @retval None
+ */
+static void FastBlinkCallback(void)
+{
+    LED_R_TOGGLE();
+}
+
+/**
+ * @brief  Periodic software timer callback, toggles LED G every 500ms.
+ * @param  None
+ * @retval None
+ */
+static void SlowBlinkCallback(void)
+{
+    LED_G_TOGGLE();
+}
+
+/**
+ * @brief  One-shot software timer callback, stops the fast blink after 5s
+ *         and turns LED B on.
+ * @param  None
+ * @retval None
+ */
+static void TimeoutCallback(void)
+{
+    TIMER0_SWT_Stop(&m_stcFastBlink);
+    LED_R_OFF();
+    LED_B_ON();
+}
+
+/**
+ * @brief  Main function of example project
+ * @param  None
+ * @retval int32_t return value, if needed
+ */
+int32_t main(void)
+{
+    /* The system clock is set to HRC8MHz by default. */
+
+    /* Configure RGB LED. */
+    LedConfig();
+
+    /* Configure Timer0 and the software timer wheel. */
+    Timer0Config();
+
+    /* Any number of software timers share Timer0. Timer0 only interrupts on
+       the nearest expiry and is stopped while no timer is pending. */
+    m_stcFastBlink.u32Period   = SWT_MS_TO_TICKS(100ul);
+    m_stcFastBlink.pfnCallback = &FastBlinkCallback;
+    (void)TIMER0_SWT_Start(&m_stcFastBlink, m_stcFastBlink.u32Period);
+
+    m_stcSlowBlink.u32Period   = SWT_MS_TO_TICKS(500ul);
+    m_stcSlowBlink.pfnCallback = &SlowBlinkCallback;
+    (void)TIMER0_SWT_Start(&m_stcSlowBlink, m_stcSlowBlink.u32Period);
+
+    /* One-shot. */
+    m_stcTimeout.u32Period     = 0ul;
+    m_stcTimeout.pfnCallback   = &TimeoutCallback;
+    (void)TIMER0_SWT_Start(&m_stcTimeout, SWT_MS_TO_TICKS(5000ul));
+
+    while(1)
+    {
+        ;
+    }
+}
+
+/**
+ * @brief  Configure Timer0 as the tick source of the software timer wheel.
+ * @param  None
+ * @retval None
+ */
+static void Timer0Config(void)
+{
+    stc_irq_regi_config_t stcIrqRegiCfg;
+    stc_tim0_init_t stcTimer0Ini;
+
+    /* Enable timer0 peripheral clock */
+    CLK_FcgPeriphClockCmd(CLK_FCG_TIM0, Enable);
+
+    /* TIMER0 compare mode counting HCLK, the wheel sets the compare value. */
+    TIMER0_StructInit(&stcTimer0Ini);
+    stcTimer0Ini.u32ClockDivision = TIMER0_CLK_DIV256;
+    stcTimer0Ini.u32ClockSource = TIMER0_CLK_SRC_HCLK;
+    stcTimer0Ini.u32Tmr0Fun = TIMER0_FUNC_CMP;
+    stcTimer0Ini.u32HwTrigFunc = TIMER0_BT_HWTRG_FUNC_NONE;
+    TIMER0_Init(&stcTimer0Ini);
+
+    /* Register IRQ handler && configure NVIC. */
+    stcIrqRegiCfg.enIRQn = TIMER0_IRQn;
+    stcIrqRegiCfg.enIntSrc = TIMER0_SOURCE;
+    stcIrqRegiCfg.pfnCallback = &Timer0CompareIrqCallback;
+    INTC_IrqRegistration(&stcIrqRegiCfg);
+    NVIC_ClearPendingIRQ(stcIrqRegiCfg.enIRQn);
+    NVIC_SetPriority(stcIrqRegiCfg.enIRQn, DDL_IRQ_PRIORITY_02);
+    NVIC_EnableIRQ(stcIrqRegiCfg.enIRQn);
+
+    /* Initialize the wheel, it enables the Timer0 interrupt. */
+    TIMER0_SWT_Init();
+}
+
+/**
+ * @brief  Configure RGB LED.
+ * @param  None
+ * @retval None
+ */
+static void LedConfig(void)
+{
+    stc_gpio_init_t stcGpioInit = {0};
+
+    stcGpioInit.u16PinMode = PIN_MODE_OUT;
+    stcGpioInit.u16PinState = PIN_STATE_SET;
+    GPIO_Init(LED_R_PORT, LED_R_PIN, &stcGpioInit);
+    GPIO_Init(LED_G_PORT, LED_G_PIN, &stcGpioInit);
+    GPIO_Init(LED_B_PORT, LED_B_PIN, &stcGpioInit);
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
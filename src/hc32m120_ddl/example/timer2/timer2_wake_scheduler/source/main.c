@@ -0,0 +1,251 @@
+/**
+ *******************************************************************************
+ * @file  timer2/timer2_wake_scheduler/source/main.c
+ * @brief Main program TIMER2 wake-up scheduler for the Device Driver Library.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       agent           First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software is owned and published by:
+ * Huada Semiconductor Co., Ltd. ("HDSC").
+ *
+ * BY DOWNLOADING, INSTALLING OR USING THIS SOFTWARE, YOU AGREE TO BE BOUND
+ * BY ALL THE TERMS AND CONDITIONS OF THIS AGREEMENT.
+ *
+ * This software contains source code for use with HDSC
+ * components. This software is licensed by HDSC to be adapted only
+ * for use in systems utilizing HDSC components. HDSC shall not be
+ * responsible for misuse or illegal use of this software for devices not
+ * supported herein. HDSC is providing this software "AS IS" and will
+ * not be responsible for issues arising from incorrect user implementation
+ * of the software.
+ *
+ * Disclaimer:
+ * HDSC MAKES NO WARRANTY, EXPRESS OR IMPLIED, ARISING BY LAW OR OTHERWISE,
+ * REGARDING THE SOFTWARE (INCLUDING ANY ACCOMPANYING WRITTEN MATERIALS),
+ * ITS PERFORMANCE OR SUITABILITY FOR YOUR INTENDED USE, INCLUDING,
+ * WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, THE IMPLIED
+ * WARRANTY OF FITNESS FOR A PARTICULAR PURPOSE OR USE, AND THE IMPLIED
+ * WARRANTY OF NONINFRINGEMENT.
+ * HDSC SHALL HAVE NO LIABILITY (WHETHER IN CONTRACT, WARRANTY, TORT,
+ * NEGLIGENCE OR OTHERWISE) FOR ANY DAMAGES WHATSOEVER (INCLUDING, WITHOUT
+ * LIMITATION, DAMAGES FOR LOSS OF BUSINESS PROFITS, BUSINESS INTERRUPTION,
+ * LOSS OF BUSINESS INFORMATION, OR OTHER PECUNIARY LOSS) ARISING FROM USE OR
+ * INABILITY TO USE THE SOFTWARE, INCLUDING, WITHOUT LIMITATION, ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL OR CONSEQUENTIAL DAMAGES OR LOSS OF DATA,
+ * SAVINGS OR PROFITS,
+ * EVEN IF Disclaimer HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGES.
+ * YOU ASSUME ALL RESPONSIBILITIES FOR SELECTION OF THE SOFTWARE TO ACHIEVE YOUR
+ * INTENDED RESULTS, AND FOR THE INSTALLATION OF, USE OF, AND RESULTS OBTAINED
+ * FROM, THE SOFTWARE.
+ *
+ * This software may be replicated in part or whole for the licensed use,
+ * with the restriction that this Disclaimer and Copyright notice must be
+ * included with each copy of this software, whether used in part or whole,
+ * at all times.
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ddl.h"
+
+/**
+ * @addtogroup HC32M120_DDL_Examples
+ * @{
+ */
+
+/**
+ * @addtogroup Timer2_Wake_Scheduler
+ * @{
+ */
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/* Wake-up period. 5s is longer than 0xFFFF LRC ticks(2s), so the wake-up is
+   counted in three compare periods while the MCU stays in stop mode. */
+#define WAKE_PERIOD_US              (5000000ul)
+
+/* Ticks measured by the calibration against HCLK. */
+#define WAKE_CAL_TICKS              (328u)
+
+/* LED definition. */
+#define LED_R_PORT                  (GPIO_PORT_12)
+#define LED_R_PIN                   (GPIO_PIN_0)
+#define LED_R_ON()                  GPIO_ResetPins(LED_R_PORT, LED_R_PIN)
+#define LED_R_OFF()                 GPIO_SetPins(LED_R_PORT, LED_R_PIN)
+#define LED_R_TOGGLE()              GPIO_TogglePins(LED_R_PORT, LED_R_PIN)
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+static void Timer2WakeConfig(void);
+static void Timer2IrqConfig(void);
+static void StopModeConfig(void);
+static void LedConfig(void);
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+
+/**
+ * @brief  Main function of timer2_wake_scheduler project
+ * @param  None
+ * @retval int32_t return value, if needed
+ */
+int32_t main(void)
+{
+    /* The system clock is set to HRC8MHz by default. */
+
+    /* Configures LED. */
+    LedConfig();
+
+    /* Configures the TIMER2 wake-up scheduler. */
+    Timer2WakeConfig();
+
+    /* Configures stop mode. */
+    StopModeConfig();
+
+    /***************** Configuration end, application start **************/
+
+    while (1u)
+    {
+        LED_R_TOGGLE();
+
+        (void)TIMER2_WAKE_Start(WAKE_PERIOD_US);
+
+        /* The test of the expiry and WFI are done with interrupts masked, the
+           match interrupt can not slip in between. Wake-ups of the chained
+           compare periods return Reset and stop mode is entered again. */
+        while (TIMER2_WAKE_EnterStopMode() == Reset)
+        {
+            ;
+        }
+    }
+}
+
+/**
+ * @brief  TIMER2 wake-up scheduler configuration.
+ * @param  None
+ * @retval None
+ */
+static void Timer2WakeConfig(void)
+{
+    stc_timer2_wake_init_t stcInit;
+
+    /* 1. Enable TIMER2 peripheral clock and the LRC. */
+    CLK_FcgPeriphClockCmd(CLK_FCG_TIM2, Enable);
+    CLK_LRCInit(CLK_LRC_ON);
+
+    /* 2. LRC with prescaler 1, nominal 32768Hz. */
+    (void)TIMER2_WAKE_StructInit(&stcInit);
+    (void)TIMER2_WAKE_Init(&stcInit);
+
+    /* 3. The LRC can be several percent off nominal. Measure it against HCLK
+          once, the wake-up times are converted with the measured clock. */
+    (void)SysTick_Init(1000ul);
+    if (TIMER2_WAKE_Calibrate(SystemCoreClock, WAKE_CAL_TICKS) != Ok)
+    {
+        /* Keep the nominal frequency. */
+        (void)TIMER2_WAKE_SetCompensation(0l);
+    }
+
+    /* 4. Configures IRQ. */
+    Timer2IrqConfig();
+}
+
+/**
+ * @brief  TIMER2 interrupt configuration.
+ * @param  None
+ * @retval None
+ */
+static void Timer2IrqConfig(void)
+{
+    stc_irq_regi_config_t stcIrqRegiConf;
+
+    /* Configures INT_TMR2_GCMP interrupt. */
+    stcIrqRegiConf.enIntSrc    = INT_TMR2_GCMP;
+    stcIrqRegiConf.enIRQn      = Int018_IRQn;
+    stcIrqRegiConf.pfnCallback = &Timer2GCmp_IrqHandler;
+    INTC_IrqRegistration(&stcIrqRegiConf);
+    NVIC_ClearPendingIRQ(stcIrqRegiConf.enIRQn);
+    NVIC_SetPriority(stcIrqRegiConf.enIRQn, DDL_IRQ_PRIORITY_02);
+    NVIC_EnableIRQ(stcIrqRegiConf.enIRQn);
+}
+
+/**
+ * @brief  TIMER2 counter comparison match interrupt callback function.
+ * @param  None
+ * @retval None
+ */
+void Timer2GCmp_IrqHandler(void)
+{
+    TIMER2_WAKE_IrqHandler();
+}
+
+/**
+ * @brief  Stop mode configuration.
+ * @param  None
+ * @retval None
+ * @note   TIMER2_WAKE_Init() already selects the TIMER2 counter match as a
+ *         wake-up source of stop mode.
+ */
+static void StopModeConfig(void)
+{
+    stc_pwc_stop_cfg_t stcPwcStopCfg;
+
+    (void)PWC_StopStructInit(&stcPwcStopCfg);
+    stcPwcStopCfg.u8HPorSel = PWC_HPOR_OFF;
+    stcPwcStopCfg.u8HrcSel  = PWC_SYSCLK_FIX;
+    (void)PWC_StopMdConfig(&stcPwcStopCfg);
+}
+
+/**
+ * @brief  Led configuration.
+ * @param  None
+ * @retval None
+ */
+static void LedConfig(void)
+{
+    stc_gpio_init_t stcGpioInit;
+
+    /* LED R initialize */
+    GPIO_StructInit(&stcGpioInit);
+    GPIO_Init(LED_R_PORT, LED_R_PIN, &stcGpioInit);
+
+    /* TURN OFF LED before set to output */
+    LED_R_OFF();
+
+    /* Output enable */
+    GPIO_OE(LED_R_PORT, LED_R_PIN, Enable);
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
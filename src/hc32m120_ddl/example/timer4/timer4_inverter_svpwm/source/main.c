@@ -0,0 +1,300 @@
+/**
+ *******************************************************************************
+ * @file  timer4/timer4_inverter_svpwm/source/main.c
+ * @brief Main program TIMER4 three-phase inverter SVPWM for the Device Driver
+ *        Library.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       agent           First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software is owned and published by:
+ * Huada Semiconductor Co., Ltd. ("HDSC").
+ *
+ * BY DOWNLOADING, INSTALLING OR USING THIS SOFTWARE, YOU AGREE TO BE BOUND
+ * BY ALL THE TERMS AND CONDITIONS OF THIS AGREEMENT.
+ *
+ * This software contains source code for use with HDSC
+ * components. This software is licensed by HDSC to be adapted only
+ * for use in systems utilizing HDSC components. HDSC shall not be
+ * responsible for misuse or illegal use of this software for devices not
+ * supported herein. HDSC is providing this software "AS IS" and will
+ * not be responsible for issues arising from incorrect user implementation
+ * of the software.
+ *
+ * Disclaimer:
+ * HDSC MAKES NO WARRANTY, EXPRESS OR IMPLIED, ARISING BY LAW OR OTHERWISE,
+ * REGARDING THE SOFTWARE (INCLUDING ANY ACCOMPANYING WRITTEN MATERIALS),
+ * ITS PERFORMANCE OR SUITABILITY FOR YOUR INTENDED USE, INCLUDING,
+ * WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, THE IMPLIED
+ * WARRANTY OF FITNESS FOR A PARTICULAR PURPOSE OR USE, AND THE IMPLIED
+ * WARRANTY OF NONINFRINGEMENT.
+ * HDSC SHALL HAVE NO LIABILITY (WHETHER IN CONTRACT, WARRANTY, TORT,
+ * NEGLIGENCE OR OTHERWISE) FOR ANY DAMAGES WHATSOEVER (INCLUDING, WITHOUT
+ * LIMITATION, DAMAGES FOR LOSS OF BUSINESS PROFITS, BUSINESS INTERRUPTION,
+ * LOSS OF BUSINESS INFORMATION, OR OTHER PECUNIARY LOSS) ARISING FROM USE OR
+ * INABILITY TO USE THE SOFTWARE, INCLUDING, WITHOUT LIMITATION, ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL OR CONSEQUENTIAL DAMAGES OR LOSS OF DATA,
+ * SAVINGS OR PROFITS,
+ * EVEN IF Disclaimer HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGES.
+ * YOU ASSUME ALL RESPONSIBILITIES FOR SELECTION OF THE SOFTWARE TO ACHIEVE YOUR
+ * INTENDED RESULTS, AND FOR THE INSTALLATION OF, USE OF, AND RESULTS OBTAINED
+ * FROM, THE SOFTWARE.
+ *
+ * This software may be replicated in part or whole for the licensed use,
+ * with the restriction that this Disclaimer and Copyright notice must be
+ * included with each copy of this software, whether used in part or whole,
+ * at all times.
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ddl.h"
+
+/**
+ * @addtogroup HC32M120_DDL_Examples
+ * @{
+ */
+
+/**
+ * @addtogroup TIMER4_Inverter_Svpwm
+ * @{
+ */
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/* TIM4 PWM Port/Pin definition of phase U.
+   Phase V and W are routed the same way on their own pins. */
+#define TIM4_1_OXH_PORT                 (GPIO_PORT_6)
+#define TIM4_1_OXH_PIN                  (GPIO_PIN_1)
+#define TIM4_1_OXH_GPIO_FUNC            (GPIO_FUNC_4_TIM4)
+
+#define TIM4_1_OXL_PORT                 (GPIO_PORT_6)
+#define TIM4_1_OXL_PIN                  (GPIO_PIN_0)
+#define TIM4_1_OXL_GPIO_FUNC            (GPIO_FUNC_2_TIM4)
+
+/* LED definition */
+#define LED_R_PORT                      (GPIO_PORT_12)
+#define LED_R_PIN                       (GPIO_PIN_0)
+#define LED_R_ON()                      (GPIO_ResetPins(LED_R_PORT, LED_R_PIN))
+#define LED_R_OFF()                     (GPIO_SetPins(LED_R_PORT, LED_R_PIN))
+#define LED_R_TOGGLE()                  (GPIO_TogglePins(LED_R_PORT, LED_R_PIN))
+
+/* Function clock gate definition */
+#define FUNCTION_CLK_GATE               (CLK_FCG_TIM4)
+
+/* 20kHz center-aligned PWM from 8MHz: period = 2 * 200 count clocks */
+#define PWM_CYCLE_VAL                   ((uint16_t)200u)
+
+/* 1us dead time at 8MHz */
+#define PWM_DEAD_TIME                   ((uint16_t)8u)
+
+/* Vector step and LED toggle periods in PWM periods */
+#define VECTOR_STEP_DIV                 ((uint16_t)4u)      /* 5kHz */
+#define LED_TOGGLE_DIV                  ((uint16_t)10000u)  /* 2Hz */
+
+/* Timer4 counter interrupt definition */
+#define TIMER4_CNT_UDF_INT              (INT_TMR4_GUDF)
+#define TIMER4_CNT_UDF_IRQn             (Int017_IRQn)
+
+/* Steps of the rotating voltage vector per electrical turn */
+#define VECTOR_STEPS                    (32u)
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+static void SystemClockConfig(void);
+static void LedConfig(void);
+static void Timer4IrqConfig(void);
+static void VectorStep(void);
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+/* sin() in Q15 of Vdc/sqrt(3), amplitude 0.5 */
+static const int16_t m_ai16Sin[VECTOR_STEPS] =
+{
+         0,   3196,   6270,   9102,  11585,  13623,  15137,  16069,
+     16384,  16069,  15137,  13623,  11585,   9102,   6270,   3196,
+         0,  -3196,  -6270,  -9102, -11585, -13623, -15137, -16069,
+    -16384, -16069, -15137, -13623, -11585,  -9102,  -6270,  -3196,
+};
+
+static uint8_t m_u8VectorStep = 0u;
+static uint16_t m_u16VectorDiv = 0u;
+static uint16_t m_u16LedDiv = 0u;
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+
+/**
+ * @brief  Configure system clock.
+ * @param  None
+ * @retval None
+ */
+static void SystemClockConfig(void)
+{
+    /* Configure the system clock to HRC8MHz. */
+    CLK_HRCInit(CLK_HRC_ON, CLK_HRCFREQ_8);
+}
+
+/**
+ * @brief  Main function of TIMER4 inverter svpwm
+ * @param  None
+ * @retval int32_t return value, if needed
+ */
+int32_t main(void)
+{
+    stc_timer4_inv_init_t stcInvInit;
+
+    /* Configure system clock. */
+    SystemClockConfig();
+
+    /* Configure LED. */
+    LedConfig();
+
+    /* Enable peripheral clock */
+    CLK_FcgPeriphClockCmd(FUNCTION_CLK_GATE, Enable);
+
+    /* Three-phase PWM, the compare values transfer at the counter zero */
+    stcInvInit.u16CycleVal = PWM_CYCLE_VAL;
+    stcInvInit.u16CntClkDiv = TIMER4_CNT_CLK_DIV1;
+    stcInvInit.u16PwmClkDiv = TIMER4_PWM_CLK_DIV1;
+    stcInvInit.u16DeadTime = PWM_DEAD_TIME;
+    stcInvInit.u16OccrBufMode = TIMER4_OCO_OCCR_BUF_CNT_ZERO;
+    (void)TIMER4_INV_Init(&stcInvInit);
+
+    /* Initialize PWM I/O */
+    GPIO_SetFunc(TIM4_1_OXH_PORT, TIM4_1_OXH_PIN, TIM4_1_OXH_GPIO_FUNC);
+    GPIO_SetFunc(TIM4_1_OXL_PORT, TIM4_1_OXL_PIN, TIM4_1_OXL_GPIO_FUNC);
+
+    /* Start Timer4 counter */
+    TIMER4_CNT_Start();
+
+    /* Align the rotor on phase U for 500ms */
+    TIMER4_INV_SetCompare((PWM_CYCLE_VAL * 3u) / 4u, PWM_CYCLE_VAL / 4u, PWM_CYCLE_VAL / 4u);
+
+    LED_R_ON();
+    DDL_Delay1ms(500ul);
+
+    /* Rotate the voltage vector from the counter zero interrupt. The new
+       compare values transfer at the next zero. */
+    Timer4IrqConfig();
+
+    while (1)
+    {
+        ;
+    }
+}
+
+/**
+ * @brief  Advance the voltage vector by one step.
+ * @param  None
+ * @retval None
+ */
+static void VectorStep(void)
+{
+    int16_t i16Alpha;
+    int16_t i16Beta;
+
+    i16Alpha = m_ai16Sin[(m_u8VectorStep + (VECTOR_STEPS / 4u)) % VECTOR_STEPS];
+    i16Beta = m_ai16Sin[m_u8VectorStep];
+    (void)TIMER4_INV_Svpwm(i16Alpha, i16Beta);
+
+    m_u8VectorStep = (uint8_t)((m_u8VectorStep + 1u) % VECTOR_STEPS);
+}
+
+/**
+ * @brief  TIMER4 counter underflow(zero) IRQ handler
+ * @param  None
+ * @retval None
+ */
+void Timer4GUD_IrqHandler(void)
+{
+    TIMER4_CNT_ClearFlag(TIMER4_CNT_FLAG_ZERO);
+
+    /* 5kHz: step the voltage vector */
+    m_u16VectorDiv++;
+    if (m_u16VectorDiv >= VECTOR_STEP_DIV)
+    {
+        m_u16VectorDiv = 0u;
+        VectorStep();
+    }
+
+    /* 2Hz: toggle the LED */
+    m_u16LedDiv++;
+    if (m_u16LedDiv >= LED_TOGGLE_DIV)
+    {
+        m_u16LedDiv = 0u;
+        LED_R_TOGGLE();
+    }
+}
+
+/**
+ * @brief  Configure the TIMER4 counter zero interrupt.
+ * @param  None
+ * @retval None
+ */
+static void Timer4IrqConfig(void)
+{
+    stc_irq_regi_config_t stcIrqRegiConf;
+
+    /* Register IRQ handler && configure NVIC. */
+    stcIrqRegiConf.enIRQn = TIMER4_CNT_UDF_IRQn;
+    stcIrqRegiConf.enIntSrc = TIMER4_CNT_UDF_INT;
+    stcIrqRegiConf.pfnCallback = &Timer4GUD_IrqHandler;
+    INTC_IrqRegistration(&stcIrqRegiConf);
+    NVIC_ClearPendingIRQ(stcIrqRegiConf.enIRQn);
+    NVIC_SetPriority(stcIrqRegiConf.enIRQn, DDL_IRQ_PRIORITY_02);
+    NVIC_EnableIRQ(stcIrqRegiConf.enIRQn);
+
+    TIMER4_CNT_ClearFlag(TIMER4_CNT_FLAG_ZERO);
+    TIMER4_CNT_IntCmd(TIMER4_CNT_IT_ZERO, Enable);
+}
+
+/**
+ * @brief  Led configuration.
+ * @param  None
+ * @retval None
+ */
+static void LedConfig(void)
+{
+    stc_gpio_init_t stcGpioInit;
+
+    /* LED R initialize */
+    GPIO_StructInit(&stcGpioInit);
+    GPIO_Init(LED_R_PORT, LED_R_PIN, &stcGpioInit);
+
+    /* TURN OFF LED before set to output */
+    LED_R_OFF();
+
+    /* Output enable */
+    GPIO_OE(LED_R_PORT, LED_R_PIN, Enable);
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
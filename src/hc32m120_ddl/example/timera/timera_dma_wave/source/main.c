@@ -0,0 +1,277 @@
+/**
+ *******************************************************************************
+ * @file  timera/timera_dma_wave/source/main.c
+ * @brief Main program TIMERA DMA-fed PWM waveform for the Device Driver Library.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       agent           First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software is owned and published by:
+ * Huada Semiconductor Co., Ltd. ("HDSC").
+ *
+ * BY DOWNLOADING, INSTALLING OR USING THIS SOFTWARE, YOU AGREE TO BE BOUND
+ * BY ALL THE TERMS AND CONDITIONS OF THIS AGREEMENT.
+ *
+ * This software contains source code for use with HDSC
+ * components. This software is licensed by HDSC to be adapted only
+ * for use in systems utilizing HDSC components. HDSC shall not be
+ * responsible for misuse or illegal use of this software for devices not
+ * supported herein. HDSC is providing this software "AS IS" and will
+ * not be responsible for issues arising from incorrect user implementation
+ * of the software.
+ *
+ * Disclaimer:
+ * HDSC MAKES NO WARRANTY, EXPRESS OR IMPLIED, ARISING BY LAW OR OTHERWISE,
+ * REGARDING THE SOFTWARE (INCLUDING ANY ACCOMPANYING WRITTEN MATERIALS),
+ * ITS PERFORMANCE OR SUITABILITY FOR YOUR INTENDED USE, INCLUDING,
+ * WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, THE IMPLIED
+ * WARRANTY OF FITNESS FOR A PARTICULAR PURPOSE OR USE, AND THE IMPLIED
+ * WARRANTY OF NONINFRINGEMENT.
+ * HDSC SHALL HAVE NO LIABILITY (WHETHER IN CONTRACT, WARRANTY, TORT,
+ * NEGLIGENCE OR OTHERWISE) FOR ANY DAMAGES WHATSOEVER (INCLUDING, WITHOUT
+ * LIMITATION, DAMAGES FOR LOSS OF BUSINESS PROFITS, BUSINESS INTERRUPTION,
+ * LOSS OF BUSINESS INFORMATION, OR OTHER PECUNIARY LOSS) ARISING FROM USE OR
+ * INABILITY TO USE THE SOFTWARE, INCLUDING, WITHOUT LIMITATION, ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL OR CONSEQUENTIAL DAMAGES OR LOSS OF DATA,
+ * SAVINGS OR PROFITS,
+ * EVEN IF Disclaimer HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGES.
+ * YOU ASSUME ALL RESPONSIBILITIES FOR SELECTION OF THE SOFTWARE TO ACHIEVE YOUR
+ * INTENDED RESULTS, AND FOR THE INSTALLATION OF, USE OF, AND RESULTS OBTAINED
+ * FROM, THE SOFTWARE.
+ *
+ * This software may be replicated in part or whole for the licensed use,
+ * with the restriction that this Disclaimer and Copyright notice must be
+ * included with each copy of this software, whether used in part or whole,
+ * at all times.
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ddl.h"
+
+/**
+ * @addtogroup HC32M120_DDL_Examples
+ * @{
+ */
+
+/**
+ * @addtogroup TIMERA_DMA_Wave
+ * @{
+ */
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/* LED_R Port/Pin definition */
+#define LED_R_PORT                      (GPIO_PORT_12)
+#define LED_R_PIN                       (GPIO_PIN_0)
+
+#define LED_R_ON()                      (GPIO_ResetPins(LED_R_PORT, LED_R_PIN))
+#define LED_R_OFF()                     (GPIO_SetPins(LED_R_PORT, LED_R_PIN))
+
+/* TIMERA unit definition */
+#define TIMERA_UNIT1                    (M0P_TMRA)
+#define TIMERA_UNIT1_CLOCK              (CLK_FCG_TIMA)
+/* 32kHz PWM at HCLK 32MHz */
+#define TIMERA_UNIT1_PERIOD_VALUE       ((uint16_t)1000u)
+
+/* TIMERA channel 1 Port/Pin definition */
+#define TIMERA_UNIT1_CH1                (TIMERA_CHANNEL_CH1)
+#define TIMERA_UNIT1_CH1_PORT           (GPIO_PORT_7)
+#define TIMERA_UNIT1_CH1_PIN            (GPIO_PIN_3)
+#define TIMERA_UNIT1_CH1_FUNC           (GPIO_FUNC_7_TIMA)
+
+/* DMA channel feeding the compare value */
+#define WAVE_DMA_CH                     (DMA_CHANNEL_0)
+
+/* Table lengths */
+#define RAMP_LEN                        (32u)
+#define SINE_LEN                        (64u)
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+/* Soft start from 0% to 50% duty */
+static const uint16_t m_au16Ramp[RAMP_LEN] =
+{
+      16u,   31u,   47u,   62u,   78u,   94u,  109u,  125u,
+     141u,  156u,  172u,  188u,  203u,  219u,  234u,  250u,
+     266u,  281u,  297u,  312u,  328u,  344u,  359u,  375u,
+     391u,  406u,  422u,  438u,  453u,  469u,  484u,  500u,
+};
+
+/* 50% +/- 45% sine, 500Hz after an RC low pass filter */
+static const uint16_t m_au16Sine[SINE_LEN] =
+{
+     500u,  544u,  588u,  631u,  672u,  712u,  750u,  785u,
+     818u,  848u,  874u,  897u,  916u,  931u,  941u,  948u,
+     950u,  948u,  941u,  931u,  916u,  897u,  874u,  848u,
+     818u,  785u,  750u,  712u,  672u,  631u,  588u,  544u,
+     500u,  456u,  412u,  369u,  328u,  288u,  250u,  215u,
+     182u,  152u,  126u,  103u,   84u,   69u,   59u,   52u,
+      50u,   52u,   59u,   69u,   84u,  103u,  126u,  152u,
+     182u,  215u,  250u,  288u,  328u,  369u,  412u,  456u,
+};
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @brief  Configure System clock.
+ * @param  None
+ * @retval None
+ */
+static void SystemClk_Config(void)
+{
+    /* Configure the system clock to HRC32MHz. */
+    CLK_HRCInit(CLK_HRC_ON, CLK_HRCFREQ_32);
+}
+
+/**
+ * @brief  Configure LED.
+ * @param  None
+ * @retval None
+ */
+static void Led_Config(void)
+{
+    stc_gpio_init_t stcGpioInit;
+
+    /* Configure structure initialization */
+    GPIO_StructInit(&stcGpioInit);
+
+    /* LED Port/Pin initialization */
+    stcGpioInit.u16PinMode = PIN_MODE_OUT;
+    GPIO_Init(LED_R_PORT, LED_R_PIN, &stcGpioInit);
+    LED_R_OFF();
+}
+
+/**
+ * @brief  Configure DMA unit.
+ * @param  None
+ * @retval None
+ */
+static void Dma_Config(void)
+{
+    /* DMA is triggered by the TimerA overflow event through AOS */
+    CLK_FcgPeriphClockCmd(CLK_FCG_DMA, Enable);
+    CLK_FcgPeriphClockCmd(CLK_FCG_AOS, Enable);
+
+    DMA_Cmd(Enable);
+}
+
+/**
+ * @brief  Configure TimerA function.
+ * @param  None
+ * @retval None
+ */
+static void Timera_Config(void)
+{
+    stc_timera_init_t stcTimeraInit;
+    stc_timera_oc_init_t stcTimeraOCInit;
+
+    /* Configuration structure initialization */
+    TIMERA_StructInit(&stcTimeraInit);
+
+    /* Configuration peripheral clock */
+    CLK_FcgPeriphClockCmd(TIMERA_UNIT1_CLOCK, Enable);
+
+    /* Configuration TIMERA compare Port */
+    GPIO_SetFunc(TIMERA_UNIT1_CH1_PORT, TIMERA_UNIT1_CH1_PIN, TIMERA_UNIT1_CH1_FUNC);
+
+    /* Configuration timera 1 unit structure */
+    stcTimeraInit.u16CountMode = TIMERA_SAWTOOTH_WAVE;
+    stcTimeraInit.u16ClkDiv = TIMERA_CLKDIV_DIV1;
+    stcTimeraInit.u16PeriodVal = TIMERA_UNIT1_PERIOD_VALUE;
+    TIMERA_Init(TIMERA_UNIT1, &stcTimeraInit);
+
+    /* High from the start of the period until the compare match */
+    stcTimeraOCInit.u16CompareVal = 0u;
+    stcTimeraOCInit.u16StartCountOutput = TIMERA_OC_STARTCOUNT_OUTPUT_HIGH;
+    stcTimeraOCInit.u16StopCountOutput = TIMERA_OC_STOPCOUNT_OUTPUT_LOW;
+    stcTimeraOCInit.u16CompareMatchOutput = TIMERA_OC_CMPMATCH_OUTPUT_LOW;
+    stcTimeraOCInit.u16PeriodMatchOutput = TIMERA_OC_PERIODMATCH_OUTPUT_HIGH;
+    stcTimeraOCInit.u16PortOutputState = TIMERA_OC_FORCE_OUTPUT_INVALID;
+    stcTimeraOCInit.u16CacheState = TIMERA_OC_CACHE_DISABLE;
+    stcTimeraOCInit.u16CacheTransmitCondition = TIMERA_OC_CACHE_TRANSMIT_INVALID;
+    TIMERA_OC_Init(TIMERA_UNIT1, TIMERA_UNIT1_CH1, &stcTimeraOCInit);
+    TIMERA_OC_PwmCmd(TIMERA_UNIT1, TIMERA_UNIT1_CH1, Enable);
+}
+
+/**
+ * @brief  Main function of TIMERA DMA wave.
+ * @param  None
+ * @retval int32_t return value, if needed
+ */
+int32_t main(void)
+{
+    stc_timera_wave_cfg_t stcWaveCfg;
+
+    /* Configure system clock. */
+    SystemClk_Config();
+
+    /* Configure LED. */
+    Led_Config();
+
+    /* Configure DMA and TimerA */
+    Dma_Config();
+    Timera_Config();
+
+    /* Play the soft start ramp once, one entry per PWM period */
+    stcWaveCfg.u8Channel = TIMERA_UNIT1_CH1;
+    stcWaveCfg.u8DmaCh = WAVE_DMA_CH;
+    stcWaveCfg.pu16Table = m_au16Ramp;
+    stcWaveCfg.u16Len = RAMP_LEN;
+    stcWaveCfg.enLoop = Disable;
+    TIMERA_WAVE_Start(TIMERA_UNIT1, &stcWaveCfg);
+
+    TIMERA_Cmd(TIMERA_UNIT1, Enable);
+
+    /* Wait for the last ramp entry */
+    while (Reset == DMA_GetCplFlag(WAVE_DMA_CH, DMA_FLAG_TC))
+    {
+        ;
+    }
+
+    /* Replay the sine table endlessly, the DMA reloads it without CPU load */
+    stcWaveCfg.pu16Table = m_au16Sine;
+    stcWaveCfg.u16Len = SINE_LEN;
+    stcWaveCfg.enLoop = Enable;
+    TIMERA_WAVE_Start(TIMERA_UNIT1, &stcWaveCfg);
+
+    LED_R_ON();
+
+    while (1)
+    {
+        ;
+    }
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -0,0 +1,312 @@
+/**
+ *******************************************************************************
+ * @file  timera/timera_quadrature_encoder/source/main.c
+ * @brief Main program TIMERA quadrature encoder for the Device Driver Library.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       agent           First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software is owned and published by:
+ * Huada Semiconductor Co., Ltd. ("HDSC").
+ *
+ * BY DOWNLOADING, INSTALLING OR USING THIS SOFTWARE, YOU AGREE TO BE BOUND
+ * BY ALL THE TERMS AND CONDITIONS OF THIS AGREEMENT.
+ *
+ * This software contains source code for use with HDSC
+ * components. This software is licensed by HDSC to be adapted only
+ * for use in systems utilizing HDSC components. HDSC shall not be
+ * responsible for misuse or illegal use of this software for devices not
+ * supported herein. HDSC is providing this software "AS IS" and will
+ * not be responsible for issues arising from incorrect user implementation
+ * of the software.
+ *
+ * Disclaimer:
+ * HDSC MAKES NO WARRANTY, EXPRESS OR IMPLIED, ARISING BY LAW OR OTHERWISE,
+ * REGARDING THE SOFTWARE (INCLUDING ANY ACCOMPANYING WRITTEN MATERIALS),
+ * ITS PERFORMANCE OR SUITABILITY FOR YOUR INTENDED USE, INCLUDING,
+ * WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, THE IMPLIED
+ * WARRANTY OF FITNESS FOR A PARTICULAR PURPOSE OR USE, AND THE IMPLIED
+ * WARRANTY OF NONINFRINGEMENT.
+ * HDSC SHALL HAVE NO LIABILITY (WHETHER IN CONTRACT, WARRANTY, TORT,
+ * NEGLIGENCE OR OTHERWISE) FOR ANY DAMAGES WHATSOEVER (INCLUDING, WITHOUT
+ * LIMITATION, DAMAGES FOR LOSS OF BUSINESS PROFITS, BUSINESS INTERRUPTION,
+ * LOSS OF BUSINESS INFORMATION, OR OTHER PECUNIARY LOSS) ARISING FROM USE OR
+ * INABILITY TO USE THE SOFTWARE, INCLUDING, WITHOUT LIMITATION, ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL OR CONSEQUENTIAL DAMAGES OR LOSS OF DATA,
+ * SAVINGS OR PROFITS,
+ * EVEN IF Disclaimer HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGES.
+ * YOU ASSUME ALL RESPONSIBILITIES FOR SELECTION OF THE SOFTWARE TO ACHIEVE YOUR
+ * INTENDED RESULTS, AND FOR THE INSTALLATION OF, USE OF, AND RESULTS OBTAINED
+ * FROM, THE SOFTWARE.
+ *
+ * This software may be replicated in part or whole for the licensed use,
+ * with the restriction that this Disclaimer and Copyright notice must be
+ * included with each copy of this software, whether used in part or whole,
+ * at all times.
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ddl.h"
+
+/**
+ * @addtogroup HC32M120_DDL_Examples
+ * @{
+ */
+
+/**
+ * @addtogroup TIMERA_Quadrature_Encoder
+ * @{
+ */
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/* LED_R Port/Pin definition */
+#define LED_R_PORT                      (GPIO_PORT_12)
+#define LED_R_PIN                       (GPIO_PIN_0)
+
+#define LED_R_ON()                      (GPIO_ResetPins(LED_R_PORT, LED_R_PIN))
+#define LED_R_OFF()                     (GPIO_SetPins(LED_R_PORT, LED_R_PIN))
+
+/* LED_G Port/Pin definition */
+#define LED_G_PORT                      (GPIO_PORT_7)
+#define LED_G_PIN                       (GPIO_PIN_0)
+
+#define LED_G_ON()                      (GPIO_ResetPins(LED_G_PORT, LED_G_PIN))
+#define LED_G_OFF()                     (GPIO_SetPins(LED_G_PORT, LED_G_PIN))
+
+/* TIMERA unit definition */
+#define TIMERA_UNIT1                    (M0P_TMRA)
+#define TIMERA_UNIT1_CLOCK              (CLK_FCG_TIMA)
+
+/* The overflow, underflow and index capture interrupts share one IRQ */
+#define TIMERA_UNIT1_IRQn               (Int028_IRQn)
+
+/* TIMERA CLKA(phase A) Port/Pin definition */
+#define TIMERA_UNIT1_CLKA_PORT          (GPIO_PORT_7)
+#define TIMERA_UNIT1_CLKA_PIN           (GPIO_PIN_5)
+#define TIMERA_UNIT1_CLKA_FUNC          (GPIO_FUNC_7_TIMA)
+
+/* TIMERA CLKB(phase B) Port/Pin definition */
+#define TIMERA_UNIT1_CLKB_PORT          (GPIO_PORT_7)
+#define TIMERA_UNIT1_CLKB_PIN           (GPIO_PIN_4)
+#define TIMERA_UNIT1_CLKB_FUNC          (GPIO_FUNC_7_TIMA)
+
+/* TIMERA channel 1(index pulse) Port/Pin definition */
+#define TIMERA_UNIT1_INDEX_CH           (TIMERA_CHANNEL_CH1)
+#define TIMERA_UNIT1_INDEX_PORT         (GPIO_PORT_7)
+#define TIMERA_UNIT1_INDEX_PIN          (GPIO_PIN_3)
+#define TIMERA_UNIT1_INDEX_FUNC         (GPIO_FUNC_7_TIMA)
+
+/* Speed loop period in SysTick ticks(1ms) */
+#define SPEED_LOOP_PERIOD               (1ul)
+
+/* Speed window: at least 64 counts, at most 100ms */
+#define SPEED_MIN_COUNT                 (64ul)
+#define SPEED_MAX_WINDOW_MS             (100ul)
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+/* Position relative to the last index pulse, watch it in the debugger */
+static __IO int32_t m_i32RelPos = 0;
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @brief  TimerA overflow interrupt callback function.
+ * @param  None
+ * @retval None
+ */
+void TimerAOV_IrqHandler(void)
+{
+    TIMERA_ENC_IrqHandler(TIMERA_UNIT1);
+}
+
+/**
+ * @brief  TimerA underflow interrupt callback function.
+ * @param  None
+ * @retval None
+ */
+void TimerAUD_IrqHandler(void)
+{
+    TIMERA_ENC_IrqHandler(TIMERA_UNIT1);
+}
+
+/**
+ * @brief  TimerA compare match(index capture) interrupt callback function.
+ * @param  None
+ * @retval None
+ */
+void TimerACmp_IrqHandler(void)
+{
+    TIMERA_ENC_IrqHandler(TIMERA_UNIT1);
+}
+
+/**
+ * @brief  Configure System clock.
+ * @param  None
+ * @retval None
+ */
+static void SystemClk_Config(void)
+{
+    /* Configure the system clock to HRC32MHz. */
+    CLK_HRCInit(CLK_HRC_ON, CLK_HRCFREQ_32);
+}
+
+/**
+ * @brief  Configure LED.
+ * @param  None
+ * @retval None
+ */
+static void Led_Config(void)
+{
+    stc_gpio_init_t stcGpioInit;
+
+    /* Configure structure initialization */
+    GPIO_StructInit(&stcGpioInit);
+
+    /* LED Port/Pin initialization */
+    stcGpioInit.u16PinMode = PIN_MODE_OUT;
+    GPIO_Init(LED_R_PORT, LED_R_PIN, &stcGpioInit);
+    GPIO_Init(LED_G_PORT, LED_G_PIN, &stcGpioInit);
+    LED_R_OFF();
+    LED_G_OFF();
+}
+
+/**
+ * @brief  Configure TimerA function.
+ * @param  None
+ * @retval None
+ */
+static void Timera_Config(void)
+{
+    stc_timera_enc_init_t stcEncInit;
+
+    /* Configuration peripheral clock */
+    CLK_FcgPeriphClockCmd(TIMERA_UNIT1_CLOCK, Enable);
+
+    /* Configuration TIMERA encoder Port */
+    GPIO_SetFunc(TIMERA_UNIT1_CLKA_PORT, TIMERA_UNIT1_CLKA_PIN, TIMERA_UNIT1_CLKA_FUNC);
+    GPIO_SetFunc(TIMERA_UNIT1_CLKB_PORT, TIMERA_UNIT1_CLKB_PIN, TIMERA_UNIT1_CLKB_FUNC);
+    GPIO_SetFunc(TIMERA_UNIT1_INDEX_PORT, TIMERA_UNIT1_INDEX_PIN, TIMERA_UNIT1_INDEX_FUNC);
+
+    /* Count all four edges of A/B, index pulse on channel 1 */
+    stcEncInit.u16EncMode = TIMERA_ENC_MODE_X4;
+    stcEncInit.enFilterCmd = Enable;
+    stcEncInit.u16ClkAFilterClkDiv = TIMERA_CLKA_CLKDIV_DIV4;
+    stcEncInit.u16ClkBFilterClkDiv = TIMERA_CLKB_CLKDIV_DIV4;
+    stcEncInit.u8IndexCh = TIMERA_UNIT1_INDEX_CH;
+    stcEncInit.u16IndexFilterClkDiv = TIMERA_IC_PWM_CLKDIV_DIV4;
+    /* Time stamps are SysTick milliseconds */
+    stcEncInit.u32TickFreq = 1000ul;
+    stcEncInit.u32MinCount = SPEED_MIN_COUNT;
+    stcEncInit.u32MaxWindow = SPEED_MAX_WINDOW_MS;
+    TIMERA_ENC_Init(TIMERA_UNIT1, &stcEncInit);
+
+    /* Enable the share IRQ of the TimerA interrupts */
+    INTC_ShareIrqCmd(INT_TMRA_OVF, Enable);
+    INTC_ShareIrqCmd(INT_TMRA_UDF, Enable);
+    INTC_ShareIrqCmd(INT_TMRA_CMP, Enable);
+    NVIC_ClearPendingIRQ(TIMERA_UNIT1_IRQn);
+    NVIC_SetPriority(TIMERA_UNIT1_IRQn, DDL_IRQ_PRIORITY_DEFAULT);
+    NVIC_EnableIRQ(TIMERA_UNIT1_IRQn);
+}
+
+/**
+ * @brief  Main function of TIMERA quadrature encoder.
+ * @param  None
+ * @retval int32_t return value, if needed
+ */
+int32_t main(void)
+{
+    uint32_t u32LastTick;
+    int32_t i32Speed;
+    int32_t i32Pos;
+    int32_t i32IndexPos;
+    uint32_t u32IndexCnt;
+
+    /* Configure system clock. */
+    SystemClk_Config();
+
+    /* SysTick 1ms, time stamps of the speed measurement */
+    SysTick_Init(1000ul);
+
+    /* Configure LED. */
+    Led_Config();
+
+    /* Configure TimerA */
+    Timera_Config();
+
+    /* Start the encoder counter */
+    TIMERA_Cmd(TIMERA_UNIT1, Enable);
+
+    u32LastTick = SysTick_GetTick();
+    while (1)
+    {
+        /* 1kHz speed loop */
+        if ((SysTick_GetTick() - u32LastTick) >= SPEED_LOOP_PERIOD)
+        {
+            u32LastTick += SPEED_LOOP_PERIOD;
+
+            i32Speed = TIMERA_ENC_GetSpeed(TIMERA_UNIT1, u32LastTick);
+            i32Pos = TIMERA_ENC_GetPosition(TIMERA_UNIT1);
+
+            /* LED_G: A leads B, LED_R: B leads A */
+            if (i32Speed > 0)
+            {
+                LED_G_ON();
+                LED_R_OFF();
+            }
+            else if (i32Speed < 0)
+            {
+                LED_G_OFF();
+                LED_R_ON();
+            }
+            else
+            {
+                LED_G_OFF();
+                LED_R_OFF();
+            }
+
+            /* Position relative to the last index pulse, e.g. for homing */
+            if (Ok == TIMERA_ENC_GetIndex(TIMERA_UNIT1, &i32IndexPos, &u32IndexCnt))
+            {
+                i32Pos -= i32IndexPos;
+            }
+            m_i32RelPos = i32Pos;
+        }
+    }
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
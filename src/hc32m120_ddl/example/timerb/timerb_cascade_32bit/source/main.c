@@ -0,0 +1,231 @@
+/**
+ *******************************************************************************
+ * @file  timerb/timerb_cascade_32bit/source/main.c
+ * @brief Main program TIMERB 32-bit cascade counter and capture for the Device
+ *        Driver Library.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       agent           First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software is owned and published by:
+ * Huada Semiconductor Co., Ltd. ("HDSC").
+ *
+ * BY DOWNLOADING, INSTALLING OR USING THIS SOFTWARE, YOU AGREE TO BE BOUND
+ * BY ALL THE TERMS AND CONDITIONS OF THIS AGREEMENT.
+ *
+ * This software contains source code for use with HDSC
+ * components. This software is licensed by HDSC to be adapted only
+ * for use in systems utilizing HDSC components. HDSC shall not be
+ * responsible for misuse or illegal use of this software for devices not
+ * supported herein. HDSC is providing this software "AS IS" and will
+ * not be responsible for issues arising from incorrect user implementation
+ * of the software.
+ *
+ * Disclaimer:
+ * HDSC MAKES NO WARRANTY, EXPRESS OR IMPLIED, ARISING BY LAW OR OTHERWISE,
+ * REGARDING THE SOFTWARE (INCLUDING ANY ACCOMPANYING WRITTEN MATERIALS),
+ * ITS PERFORMANCE OR SUITABILITY FOR YOUR INTENDED USE, INCLUDING,
+ * WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, THE IMPLIED
+ * WARRANTY OF FITNESS FOR A PARTICULAR PURPOSE OR USE, AND THE IMPLIED
+ * WARRANTY OF NONINFRINGEMENT.
+ * HDSC SHALL HAVE NO LIABILITY (WHETHER IN CONTRACT, WARRANTY, TORT,
+ * NEGLIGENCE OR OTHERWISE) FOR ANY DAMAGES WHATSOEVER (INCLUDING, WITHOUT
+ * LIMITATION, DAMAGES FOR LOSS OF BUSINESS PROFITS, BUSINESS INTERRUPTION,
+ * LOSS OF BUSINESS INFORMATION, OR OTHER PECUNIARY LOSS) ARISING FROM USE OR
+ * INABILITY TO USE THE SOFTWARE, INCLUDING, WITHOUT LIMITATION, ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL OR CONSEQUENTIAL DAMAGES OR LOSS OF DATA,
+ * SAVINGS OR PROFITS,
+ * EVEN IF Disclaimer HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGES.
+ * YOU ASSUME ALL RESPONSIBILITIES FOR SELECTION OF THE SOFTWARE TO ACHIEVE YOUR
+ * INTENDED RESULTS, AND FOR THE INSTALLATION OF, USE OF, AND RESULTS OBTAINED
+ * FROM, THE SOFTWARE.
+ *
+ * This software may be replicated in part or whole for the licensed use,
+ * with the restriction that this Disclaimer and Copyright notice must be
+ * included with each copy of this software, whether used in part or whole,
+ * at all times.
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ddl.h"
+
+/**
+ * @addtogroup HC32M120_DDL_Examples
+ * @{
+ */
+
+/**
+ * @addtogroup TIMERB_Cascade_32bit
+ * @{
+ */
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/* EXINT channel definition */
+#define EXINT_CH                            (EXINT_CH01)      /* P21: INTP1 */
+
+/* EXINT Port/Pin definition */
+#define EXINT_PORT                          (GPIO_PORT_2)
+#define EXINT_PIN                           (GPIO_PIN_1)
+
+/* Green LED Port/Pin definition */
+#define LED_G_PORT                          (GPIO_PORT_7)
+#define LED_G_PIN                           (GPIO_PIN_0)
+#define LED_G_TOGGLE()                      (GPIO_TogglePins(LED_G_PORT, LED_G_PIN))
+
+/* TIMERB cascade pair: unit 1 is the low half-word, unit 2 the high half-word */
+#define TIMERB_CASCADE_UNIT                 (M0P_TMRB1)
+
+/* HCLK 32MHz / 32: one count is 1us, the 32-bit counter wraps after 71 minutes */
+#define TIMERB_CASCADE_CLKDIV               (TIMERB_CLKDIV_DIV32)
+
+/* Function clock gate definition */
+#define FUNCTION_CLK_GATE                   (CLK_FCG_TIMB1 | CLK_FCG_TIMB2 | CLK_FCG_AOS)
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+static void SystemClockConfig(void);
+static void LedConfig(void);
+static void ExintConfig(void);
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+/* Time between the last two key presses in us, watch it in the debugger */
+static __IO uint32_t m_u32IntervalUs = 0ul;
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+
+/**
+ * @brief  Configure system clock.
+ * @param  None
+ * @retval None
+ */
+static void SystemClockConfig(void)
+{
+    /* Configure the system clock to HRC32MHz. */
+    CLK_HRCInit(CLK_HRC_ON, CLK_HRCFREQ_32);
+}
+
+/**
+ * @brief  Configure RGB LED.
+ * @param  None
+ * @retval None
+ */
+static void LedConfig(void)
+{
+    stc_gpio_init_t stcGpioInit = {0};
+
+    stcGpioInit.u16PinMode = PIN_MODE_OUT;
+    stcGpioInit.u16PinState = PIN_STATE_SET;
+    GPIO_Init(LED_G_PORT, LED_G_PIN, &stcGpioInit);
+}
+
+/**
+ * @brief  Configure the key SW2 as the EIRQ1 event source.
+ * @param  None
+ * @retval None
+ */
+static void ExintConfig(void)
+{
+    stc_gpio_init_t stcGpioInit;
+    stc_exint_config_t stcExIntInit;
+
+    /* External interrupt Ch.1 initialize */
+    GPIO_StructInit(&stcGpioInit);
+    stcGpioInit.u16ExInt = PIN_EXINT_ON;
+    GPIO_Init(EXINT_PORT, EXINT_PIN, &stcGpioInit);
+
+    /* EXINT Channel 1 (SW2) configure, only the event is used */
+    EXINT_StructInit(&stcExIntInit);
+    stcExIntInit.u16ExIntCh = EXINT_CH;
+    stcExIntInit.u8ExIntFE = EXINT_FILTER_ON;
+    stcExIntInit.u8ExIntFClk = EXINT_FCLK_HCLK_DIV8;
+    stcExIntInit.u8ExIntLvl = EXINT_TRIGGER_FALLING;
+    EXINT_Init(&stcExIntInit);
+}
+
+/**
+ * @brief  Main function of TIMERB 32-bit cascade project
+ * @param  None
+ * @retval int32_t return value, if needed
+ */
+int32_t main(void)
+{
+    uint32_t u32Capture;
+    uint32_t u32LastCapture = 0ul;
+    uint8_t u8First = 1u;
+    stc_timerb_cascade_init_t stcCascadeInit;
+
+    /* Configure system clock. */
+    SystemClockConfig();
+
+    /* Configure RGB LED. */
+    LedConfig();
+
+    /* Configure SW2. */
+    ExintConfig();
+
+    /* Enable peripheral clock */
+    CLK_FcgPeriphClockCmd(FUNCTION_CLK_GATE, Enable);
+
+    /* Both units latch on the same EIRQ1 event, so the low and the high
+       half-word of a capture always belong together. */
+    TIMERB_CASCADE_StructInit(&stcCascadeInit);
+    stcCascadeInit.u16ClkDiv = TIMERB_CASCADE_CLKDIV;
+    stcCascadeInit.u16CaptureCondition = TIMERB_IC_EVT;
+    TIMERB_CASCADE_Init(TIMERB_CASCADE_UNIT, &stcCascadeInit);
+
+    /* Set trigger source. */
+    TIMERB_SetTriggerSrc(EVT_PORT_EIRQ1);
+
+    /* Start the 32-bit counter. */
+    TIMERB_CASCADE_Start(TIMERB_CASCADE_UNIT);
+
+    while (1)
+    {
+        if (Ok == TIMERB_CASCADE_GetCapture(TIMERB_CASCADE_UNIT, &u32Capture))
+        {
+            /* The difference modulo 2^32 needs no overflow handling */
+            if (0u == u8First)
+            {
+                m_u32IntervalUs = u32Capture - u32LastCapture;
+            }
+            u8First = 0u;
+            u32LastCapture = u32Capture;
+
+            LED_G_TOGGLE();
+        }
+    }
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
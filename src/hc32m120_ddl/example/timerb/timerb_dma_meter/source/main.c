@@ -0,0 +1,261 @@
+/**
+ *******************************************************************************
+ * @file  timerb/timerb_dma_meter/source/main.c
+ * @brief Main program TIMERB DMA capture meter for the Device Driver Library.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       agent           First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software is owned and published by:
+ * Huada Semiconductor Co., Ltd. ("HDSC").
+ *
+ * BY DOWNLOADING, INSTALLING OR USING THIS SOFTWARE, YOU AGREE TO BE BOUND
+ * BY ALL THE TERMS AND CONDITIONS OF THIS AGREEMENT.
+ *
+ * This software contains source code for use with HDSC
+ * components. This software is licensed by HDSC to be adapted only
+ * for use in systems utilizing HDSC components. HDSC shall not be
+ * responsible for misuse or illegal use of this software for devices not
+ * supported herein. HDSC is providing this software "AS IS" and will
+ * not be responsible for issues arising from incorrect user implementation
+ * of the software.
+ *
+ * Disclaimer:
+ * HDSC MAKES NO WARRANTY, EXPRESS OR IMPLIED, ARISING BY LAW OR OTHERWISE,
+ * REGARDING THE SOFTWARE (INCLUDING ANY ACCOMPANYING WRITTEN MATERIALS),
+ * ITS PERFORMANCE OR SUITABILITY FOR YOUR INTENDED USE, INCLUDING,
+ * WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, THE IMPLIED
+ * WARRANTY OF FITNESS FOR A PARTICULAR PURPOSE OR USE, AND THE IMPLIED
+ * WARRANTY OF NONINFRINGEMENT.
+ * HDSC SHALL HAVE NO LIABILITY (WHETHER IN CONTRACT, WARRANTY, TORT,
+ * NEGLIGENCE OR OTHERWISE) FOR ANY DAMAGES WHATSOEVER (INCLUDING, WITHOUT
+ * LIMITATION, DAMAGES FOR LOSS OF BUSINESS PROFITS, BUSINESS INTERRUPTION,
+ * LOSS OF BUSINESS INFORMATION, OR OTHER PECUNIARY LOSS) ARISING FROM USE OR
+ * INABILITY TO USE THE SOFTWARE, INCLUDING, WITHOUT LIMITATION, ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL OR CONSEQUENTIAL DAMAGES OR LOSS OF DATA,
+ * SAVINGS OR PROFITS,
+ * EVEN IF Disclaimer HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGES.
+ * YOU ASSUME ALL RESPONSIBILITIES FOR SELECTION OF THE SOFTWARE TO ACHIEVE YOUR
+ * INTENDED RESULTS, AND FOR THE INSTALLATION OF, USE OF, AND RESULTS OBTAINED
+ * FROM, THE SOFTWARE.
+ *
+ * This software may be replicated in part or whole for the licensed use,
+ * with the restriction that this Disclaimer and Copyright notice must be
+ * included with each copy of this software, whether used in part or whole,
+ * at all times.
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ddl.h"
+
+/**
+ * @addtogroup HC32M120_DDL_Examples
+ * @{
+ */
+
+/**
+ * @addtogroup TIMERB_DMA_Meter
+ * @{
+ */
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/* Green LED Port/Pin definition */
+#define LED_G_PORT                          (GPIO_PORT_7)
+#define LED_G_PIN                           (GPIO_PIN_0)
+#define LED_G_TOGGLE()                      (GPIO_TogglePins(LED_G_PORT, LED_G_PIN))
+
+/* TIMERB meter unit: free-running counter at HCLK 32MHz */
+#define TIMERB_METER_UNIT                   (M0P_TMRB1)
+#define TIMERB_METER_CNT_CLK_FREQ           (32000000ul)
+
+/* TIMERB output compare unit: 1kHz 25% duty test signal */
+#define TIMERB_OC_UNIT                      (M0P_TMRB3)
+#define TIMERB_OC_UNIT_PERIOD_VALUE         ((uint16_t)32000u)
+#define TIMERB_OC_UNIT_COMPARE_VALUE        ((uint16_t)8000u)
+
+/* TIMERB TIMB_t_PWM1 Port/Pin definition, connect P62 to P15 */
+#define TIMERB_METER_UNIT_PWM1_PORT         (GPIO_PORT_1)     /* P15: TIMB_1_PWM1 */
+#define TIMERB_METER_UNIT_PWM1_PIN          (GPIO_PIN_5)
+#define TIMERB_METER_UNIT_PWM1_GPIO_FUNC    (GPIO_FUNC_2_TIMB)
+
+#define TIMERB_OC_UNIT_PWM1_PORT            (GPIO_PORT_6)     /* P62: TIMB_3_PWM1 */
+#define TIMERB_OC_UNIT_PWM1_PIN             (GPIO_PIN_2)
+#define TIMERB_OC_UNIT_PWM1_GPIO_FUNC       (GPIO_FUNC_2_TIMB)
+
+/* DMA channel moving the capture values */
+#define METER_DMA_CH                        (DMA_CHANNEL_0)
+
+/* Function clock gate definition */
+#define FUNCTION_CLK_GATE                   (CLK_FCG_TIMB1 | CLK_FCG_TIMB3 | CLK_FCG_AOS | CLK_FCG_DMA)
+
+/* Capture values per window: 31 whole input periods */
+#define METER_BUF_SIZE                      (64u)
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+static void SystemClockConfig(void);
+static void LedConfig(void);
+static void TimerbOcConfig(void);
+static void TimerbMeterConfig(void);
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+static uint16_t m_au16MeterBuf[METER_BUF_SIZE];
+
+/* Last measurement, watch it in the debugger */
+static stc_timerb_meter_result_t m_stcMeterResult;
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+
+/**
+ * @brief  Configure system clock.
+ * @param  None
+ * @retval None
+ */
+static void SystemClockConfig(void)
+{
+    /* Configure the system clock to HRC32MHz. */
+    CLK_HRCInit(CLK_HRC_ON, CLK_HRCFREQ_32);
+}
+
+/**
+ * @brief  Configure RGB LED.
+ * @param  None
+ * @retval None
+ */
+static void LedConfig(void)
+{
+    stc_gpio_init_t stcGpioInit = {0};
+
+    stcGpioInit.u16PinMode = PIN_MODE_OUT;
+    stcGpioInit.u16PinState = PIN_STATE_SET;
+    GPIO_Init(LED_G_PORT, LED_G_PIN, &stcGpioInit);
+}
+
+/**
+ * @brief  Configure TIMERB output compare, the signal to be measured.
+ * @param  None
+ * @retval None
+ */
+static void TimerbOcConfig(void)
+{
+    stc_timerb_init_t stcTimerbInit;
+    stc_timerb_oc_init_t stcTimerbOcInit;
+
+    /* Configure TIM_<t>_PWM1. */
+    GPIO_SetFunc(TIMERB_OC_UNIT_PWM1_PORT, TIMERB_OC_UNIT_PWM1_PIN, TIMERB_OC_UNIT_PWM1_GPIO_FUNC);
+
+    /* Initialize TIMERB unit. */
+    TIMERB_StructInit(&stcTimerbInit);
+    stcTimerbInit.u16PeriodVal = TIMERB_OC_UNIT_PERIOD_VALUE;
+    TIMERB_Init(TIMERB_OC_UNIT, &stcTimerbInit);
+
+    /* High from the period start until the compare match. */
+    TIMERB_OC_StructInit(&stcTimerbOcInit);
+    stcTimerbOcInit.u16CompareVal = TIMERB_OC_UNIT_COMPARE_VALUE;
+    stcTimerbOcInit.u16PortOutputState = TIMERB_OC_PORT_OUTPUT_ENABLE;
+    stcTimerbOcInit.u16StartCntOutput = TIMERB_OC_STARTCNT_OUTPUT_HIGH;
+    stcTimerbOcInit.u16StopCntOutput = TIMERB_OC_STOPCNT_OUTPUT_LOW;
+    stcTimerbOcInit.u16CompareMatchOutput = TIMERB_OC_CMPMATCH_OUTPUT_LOW;
+    stcTimerbOcInit.u16PeriodMatchOutput = TIMERB_OC_PERIODMATCH_OUTPUT_HIGH;
+    TIMERB_OC_Init(TIMERB_OC_UNIT, &stcTimerbOcInit);
+
+    TIMERB_Start(TIMERB_OC_UNIT);
+}
+
+/**
+ * @brief  Configure the TIMERB meter unit.
+ * @param  None
+ * @retval None
+ */
+static void TimerbMeterConfig(void)
+{
+    stc_timerb_init_t stcTimerbInit;
+    stc_timerb_ic_init_t stcTimerbIcInit;
+
+    /* Configure TIM_<t>_PWM1. */
+    GPIO_SetFunc(TIMERB_METER_UNIT_PWM1_PORT, TIMERB_METER_UNIT_PWM1_PIN, TIMERB_METER_UNIT_PWM1_GPIO_FUNC);
+
+    /* Free-running counter over the full 16-bit range. */
+    TIMERB_StructInit(&stcTimerbInit);
+    stcTimerbInit.u16PeriodVal = 0xFFFFu;
+    TIMERB_Init(TIMERB_METER_UNIT, &stcTimerbInit);
+
+    /* Noise filter of the input, the edges are selected by the meter. */
+    stcTimerbIcInit.u16CaptureCondition = TIMERB_IC_RISING;
+    stcTimerbIcInit.u16NoiseFilterClkDiv = TIMERB_IC_NOFICLKDIV_DIV1;
+    TIMERB_IC_Init(TIMERB_METER_UNIT, &stcTimerbIcInit);
+
+    TIMERB_Start(TIMERB_METER_UNIT);
+}
+
+/**
+ * @brief  Main function of TIMERB DMA meter project
+ * @param  None
+ * @retval int32_t return value, if needed
+ */
+int32_t main(void)
+{
+    /* Configure system clock. */
+    SystemClockConfig();
+
+    /* Configure RGB LED. */
+    LedConfig();
+
+    /* Enable peripheral clock */
+    CLK_FcgPeriphClockCmd(FUNCTION_CLK_GATE, Enable);
+
+    /* The capture values are moved by DMA, no interrupt per edge. */
+    DMA_Cmd(Enable);
+
+    TimerbOcConfig();
+    TimerbMeterConfig();
+
+    (void)TIMERB_METER_Start(TIMERB_METER_UNIT, METER_DMA_CH, m_au16MeterBuf, METER_BUF_SIZE);
+
+    while (1)
+    {
+        /* Expect 1000000mHz and 2500(25.00%) */
+        if (Ok == TIMERB_METER_Calc(METER_DMA_CH, m_au16MeterBuf, METER_BUF_SIZE,
+                                    TIMERB_METER_CNT_CLK_FREQ, &m_stcMeterResult))
+        {
+            LED_G_TOGGLE();
+
+            /* Next window */
+            (void)TIMERB_METER_Start(TIMERB_METER_UNIT, METER_DMA_CH, m_au16MeterBuf, METER_BUF_SIZE);
+        }
+    }
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
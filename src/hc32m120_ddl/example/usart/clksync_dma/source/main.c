@@ -0,0 +1,412 @@
+/**
+ *******************************************************************************
+ * @file  usart/clksync_dma/source/main.c
+ * @brief Main program of CLKSYNC full-duplex transfer for the Device Driver
+ *        Library.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       agent           First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software is owned and published by:
+ * Huada Semiconductor Co., Ltd. ("HDSC").
+ *
+ * BY DOWNLOADING, INSTALLING OR USING THIS SOFTWARE, YOU AGREE TO BE BOUND
+ * BY ALL THE TERMS AND CONDITIONS OF THIS AGREEMENT.
+ *
+ * This software contains source code for use with HDSC
+ * components. This software is licensed by HDSC to be adapted only
+ * for use in systems utilizing HDSC components. HDSC shall not be
+ * responsible for misuse or illegal use of this software for devices not
+ * supported herein. HDSC is providing this software "AS IS" and will
+ * not be responsible for issues arising from incorrect user implementation
+ * of the software.
+ *
+ * Disclaimer:
+ * HDSC MAKES NO WARRANTY, EXPRESS OR IMPLIED, ARISING BY LAW OR OTHERWISE,
+ * REGARDING THE SOFTWARE (INCLUDING ANY ACCOMPANYING WRITTEN MATERIALS),
+ * ITS PERFORMANCE OR SUITABILITY FOR YOUR INTENDED USE, INCLUDING,
+ * WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, THE IMPLIED
+ * WARRANTY OF FITNESS FOR A PARTICULAR PURPOSE OR USE, AND THE IMPLIED
+ * WARRANTY OF NONINFRINGEMENT.
+ * HDSC SHALL HAVE NO LIABILITY (WHETHER IN CONTRACT, WARRANTY, TORT,
+ * NEGLIGENCE OR OTHERWISE) FOR ANY DAMAGES WHATSOEVER (INCLUDING, WITHOUT
+ * LIMITATION, DAMAGES FOR LOSS OF BUSINESS PROFITS, BUSINESS INTERRUPTION,
+ * LOSS OF BUSINESS INFORMATION, OR OTHER PECUNIARY LOSS) ARISING FROM USE OR
+ * INABILITY TO USE THE SOFTWARE, INCLUDING, WITHOUT LIMITATION, ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL OR CONSEQUENTIAL DAMAGES OR LOSS OF DATA,
+ * SAVINGS OR PROFITS,
+ * EVEN IF Disclaimer HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGES.
+ * YOU ASSUME ALL RESPONSIBILITIES FOR SELECTION OF THE SOFTWARE TO ACHIEVE YOUR
+ * INTENDED RESULTS, AND FOR THE INSTALLATION OF, USE OF, AND RESULTS OBTAINED
+ * FROM, THE SOFTWARE.
+ *
+ * This software may be replicated in part or whole for the licensed use,
+ * with the restriction that this Disclaimer and Copyright notice must be
+ * included with each copy of this software, whether used in part or whole,
+ * at all times.
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include <string.h>
+#include "hc32_ddl.h"
+
+/**
+ * @addtogroup HC32M120_DDL_Examples
+ * @{
+ */
+
+/**
+ * @addtogroup CLKSYNC_DMA
+ * @{
+ */
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/* Red LED Port/Pin definition */
+#define LED_R_PORT                      (GPIO_PORT_12)
+#define LED_R_PIN                       (GPIO_PIN_0)
+#define LED_R_ON()                      (GPIO_ResetPins(LED_R_PORT, LED_R_PIN))
+
+/* Green LED Port/Pin definition */
+#define LED_G_PORT                      (GPIO_PORT_7)
+#define LED_G_PIN                       (GPIO_PIN_0)
+#define LED_G_ON()                      (GPIO_ResetPins(LED_G_PORT, LED_G_PIN))
+
+/* CLKSYNC CK/RX/TX Port/Pin definition.
+   Connect P12(TX) to P11(RX) to loop the data back. */
+#define CLKSYNC_CK_PORT                 (GPIO_PORT_1)
+#define CLKSYNC_CK_PIN                  (GPIO_PIN_0)        /* P10: USART2_CK */
+#define CLKSYNC_CK_GPIO_FUNC            (GPIO_FUNC_5_USART)
+
+#define CLKSYNC_RX_PORT                 (GPIO_PORT_1)
+#define CLKSYNC_RX_PIN                  (GPIO_PIN_1)        /* P11: USART2_RX */
+#define CLKSYNC_RX_GPIO_FUNC            (GPIO_FUNC_5_USART)
+
+#define CLKSYNC_TX_PORT                 (GPIO_PORT_1)
+#define CLKSYNC_TX_PIN                  (GPIO_PIN_2)        /* P12: USART2_TX */
+#define CLKSYNC_TX_GPIO_FUNC            (GPIO_FUNC_5_USART)
+
+/* Chip select of the slave device, active low */
+#define CLKSYNC_CS_PORT                 (GPIO_PORT_1)
+#define CLKSYNC_CS_PIN                  (GPIO_PIN_3)        /* P13: GPIO */
+
+/* CLKSYNC unit definition */
+#define CLKSYNC_UNIT                    (M0P_USART2)
+#define CLKSYNC_BAUDRATE                (500000ul)
+
+/* CLKSYNC unit interrupt definition */
+#define USART_UNIT_ERR_INT              (INT_USART_2_EI)
+#define USART_UNIT_ERR_IRQn             (Int016_IRQn)
+
+#define USART_UNIT_RX_INT               (INT_USART_2_RI)
+#define USART_UNIT_RX_IRQn              (Int018_IRQn)
+
+/* DMA channel 0 receives, channel 1 transmits, set by USART_ClkSyncHandleInit() */
+#define DMA_RX_TC_INT                   (INT_DAM_1_TC0)
+#define DMA_RX_TC_IRQn                  (Int008_IRQn)
+
+/* Function clock gate definition */
+#define FUNCTION_CLK_GATE               (CLK_FCG_UART2)
+
+/* Timeout of the blocking transfer without any frame received, millisecond */
+#define CLKSYNC_TIMEOUT                 (10ul)
+
+/* Transfer size */
+#define XFER_SIZE                       (64u)
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+static void LedConfig(void);
+static void ClkSyncConfig(void);
+static void ClkSyncIrqConfig(void);
+static void ClkSyncChipSelect(en_functional_state_t enNewSta);
+static void ClkSyncXferCplt(void);
+static void UsartRxIrqCallback(void);
+static void DmaRxTcIrqCallback(void);
+static en_result_t ClkSyncWaitCplt(en_result_t enRet);
+static en_result_t ClkSyncCheck(en_result_t enRet);
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+static stc_clksync_handle_t m_stcClkSync;
+static __IO uint8_t m_u8XferDone = 0u;
+
+static uint8_t m_au8TxData[XFER_SIZE];
+static uint8_t m_au8RxData[XFER_SIZE];
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @brief  Main function of CLKSYNC DMA project
+ * @param  None
+ * @retval int32_t return value, if needed
+ */
+int32_t main(void)
+{
+    uint16_t i;
+    en_result_t enRet;
+
+    for (i = 0u; i < XFER_SIZE; i++)
+    {
+        m_au8TxData[i] = (uint8_t)i;
+    }
+
+    /* Configure LED pin. */
+    LedConfig();
+
+    /* Configure CLKSYNC master, its transfer handle and IRQ. */
+    ClkSyncConfig();
+
+    /***************** Configuration end, application start **************/
+
+    /* 1. Blocking transfer: the CPU keeps two frames in flight. */
+    (void)memset(m_au8RxData, 0, sizeof(m_au8RxData));
+    enRet = USART_ClkSyncTransmitReceive(&m_stcClkSync, m_au8TxData, m_au8RxData,
+                                         XFER_SIZE, CLKSYNC_TIMEOUT);
+    enRet = ClkSyncCheck(enRet);
+
+    /* 2. Interrupt transfer: one RX IRQ per frame. */
+    if (Ok == enRet)
+    {
+        (void)memset(m_au8RxData, 0, sizeof(m_au8RxData));
+        enRet = USART_ClkSyncTransmitReceive_IT(&m_stcClkSync, m_au8TxData,
+                                                m_au8RxData, XFER_SIZE);
+        enRet = ClkSyncCheck(ClkSyncWaitCplt(enRet));
+    }
+
+    /* 3. DMA transfer: the CPU does not touch any frame. The RX IRQ is
+          not needed any more, only RX overrun raises the RX error IRQ. */
+    if (Ok == enRet)
+    {
+        NVIC_DisableIRQ(USART_UNIT_RX_IRQn);
+        (void)memset(m_au8RxData, 0, sizeof(m_au8RxData));
+        enRet = USART_ClkSyncTransmitReceive_DMA(&m_stcClkSync, m_au8TxData,
+                                                 m_au8RxData, XFER_SIZE);
+        enRet = ClkSyncCheck(ClkSyncWaitCplt(enRet));
+    }
+
+    if (Ok == enRet)
+    {
+        LED_G_ON();
+    }
+    else
+    {
+        LED_R_ON();
+    }
+
+    while (1u)
+    {
+        ;
+    }
+}
+
+/**
+ * @brief  Configure CLKSYNC master.
+ * @param  None
+ * @retval None
+ */
+static void ClkSyncConfig(void)
+{
+    stc_clksync_init_t stcClksyncInit;
+    stc_gpio_init_t stcGpioInit = {0u};
+
+    /* Configure USART CK/RX/TX pin. */
+    GPIO_SetFunc(CLKSYNC_CK_PORT, CLKSYNC_CK_PIN, CLKSYNC_CK_GPIO_FUNC);
+    GPIO_SetFunc(CLKSYNC_RX_PORT, CLKSYNC_RX_PIN, CLKSYNC_RX_GPIO_FUNC);
+    GPIO_SetFunc(CLKSYNC_TX_PORT, CLKSYNC_TX_PIN, CLKSYNC_TX_GPIO_FUNC);
+
+    /* Chip select is inactive(high) after initialization. */
+    stcGpioInit.u16PinMode = PIN_MODE_OUT;
+    stcGpioInit.u16PinState = PIN_STATE_SET;
+    GPIO_Init(CLKSYNC_CS_PORT, CLKSYNC_CS_PIN, &stcGpioInit);
+
+    /* Enable peripheral clock, DMA and AOS are used by the DMA transfer. */
+    CLK_FcgPeriphClockCmd(FUNCTION_CLK_GATE, Enable);
+    CLK_FcgPeriphClockCmd(CLK_FCG_DMA, Enable);
+    CLK_FcgPeriphClockCmd(CLK_FCG_AOS, Enable);
+    DMA_Cmd(Enable);
+
+    /* Initialize CLKSYNC function. */
+    USART_ClkSyncStructInit(&stcClksyncInit);
+    stcClksyncInit.u32Baudrate = CLKSYNC_BAUDRATE;
+    stcClksyncInit.u32ClkMode = USART_INTCLK_OUTPUT;
+    USART_ClkSyncInit(CLKSYNC_UNIT, &stcClksyncInit);
+
+    /* Initialize the transfer handle, the default DMA channels are used. */
+    (void)USART_ClkSyncHandleInit(&m_stcClkSync, CLKSYNC_UNIT);
+    m_stcClkSync.pfnChipSelect = &ClkSyncChipSelect;
+    m_stcClkSync.pfnXferCplt = &ClkSyncXferCplt;
+
+    ClkSyncIrqConfig();
+}
+
+/**
+ * @brief  Configure CLKSYNC and DMA IRQ.
+ * @param  None
+ * @retval None
+ */
+static void ClkSyncIrqConfig(void)
+{
+    stc_irq_regi_config_t stcIrqRegiConf;
+
+    /* RX error IRQ, RX overrun is accounted by the handler and ends the DMA transfer. */
+    stcIrqRegiConf.enIRQn = USART_UNIT_ERR_IRQn;
+    stcIrqRegiConf.enIntSrc = USART_UNIT_ERR_INT;
+    stcIrqRegiConf.pfnCallback = &UsartRxIrqCallback;
+    INTC_IrqRegistration(&stcIrqRegiConf);
+    NVIC_ClearPendingIRQ(stcIrqRegiConf.enIRQn);
+    NVIC_SetPriority(stcIrqRegiConf.enIRQn, DDL_IRQ_PRIORITY_03);
+    NVIC_EnableIRQ(stcIrqRegiConf.enIRQn);
+
+    /* RX IRQ of the interrupt transfer. */
+    stcIrqRegiConf.enIRQn = USART_UNIT_RX_IRQn;
+    stcIrqRegiConf.enIntSrc = USART_UNIT_RX_INT;
+    stcIrqRegiConf.pfnCallback = &UsartRxIrqCallback;
+    INTC_IrqRegistration(&stcIrqRegiConf);
+    NVIC_ClearPendingIRQ(stcIrqRegiConf.enIRQn);
+    NVIC_SetPriority(stcIrqRegiConf.enIRQn, DDL_IRQ_PRIORITY_00);
+    NVIC_EnableIRQ(stcIrqRegiConf.enIRQn);
+
+    /* Transfer complete IRQ of the RX DMA channel. */
+    stcIrqRegiConf.enIRQn = DMA_RX_TC_IRQn;
+    stcIrqRegiConf.enIntSrc = DMA_RX_TC_INT;
+    stcIrqRegiConf.pfnCallback = &DmaRxTcIrqCallback;
+    INTC_IrqRegistration(&stcIrqRegiConf);
+    NVIC_ClearPendingIRQ(stcIrqRegiConf.enIRQn);
+    NVIC_SetPriority(stcIrqRegiConf.enIRQn, DDL_IRQ_PRIORITY_03);
+    NVIC_EnableIRQ(stcIrqRegiConf.enIRQn);
+}
+
+/**
+ * @brief  Drive the chip select of the slave device.
+ * @param  [in] enNewSta                Enable: select, Disable: deselect
+ * @retval None
+ */
+static void ClkSyncChipSelect(en_functional_state_t enNewSta)
+{
+    if (Enable == enNewSta)
+    {
+        GPIO_ResetPins(CLKSYNC_CS_PORT, CLKSYNC_CS_PIN);
+    }
+    else
+    {
+        GPIO_SetPins(CLKSYNC_CS_PORT, CLKSYNC_CS_PIN);
+    }
+}
+
+/**
+ * @brief  Interrupt and DMA transfer complete callback.
+ * @param  None
+ * @retval None
+ */
+static void ClkSyncXferCplt(void)
+{
+    m_u8XferDone = 1u;
+}
+
+/**
+ * @brief  USART RX and RX error IRQ callback.
+ * @param  None
+ * @retval None
+ */
+static void UsartRxIrqCallback(void)
+{
+    USART_ClkSyncIrqHandler(&m_stcClkSync);
+}
+
+/**
+ * @brief  DMA RX channel transfer complete IRQ callback.
+ * @param  None
+ * @retval None
+ */
+static void DmaRxTcIrqCallback(void)
+{
+    USART_ClkSyncDmaIrqHandler(&m_stcClkSync);
+}
+
+/**
+ * @brief  Wait for the complete callback of the non-blocking transfer.
+ * @param  [in] enRet                   Return value of the transfer function
+ * @retval Result of the transfer
+ * @note   The transfer runs in the interrupts, other work can be done here.
+ */
+static en_result_t ClkSyncWaitCplt(en_result_t enRet)
+{
+    if (Ok == enRet)
+    {
+        while (0u == m_u8XferDone)
+        {
+            ;
+        }
+        m_u8XferDone = 0u;
+
+        enRet = m_stcClkSync.enXferResult;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Check the result and the received data of the transfer.
+ * @param  [in] enRet                   Result of the transfer
+ * @retval An en_result_t enumeration value:
+ *           - Ok: The received data is the same as the transmitted data
+ *           - Error: Transfer failed, frames lost or data mismatch
+ */
+static en_result_t ClkSyncCheck(en_result_t enRet)
+{
+    if ((Ok != enRet) ||
+        (0u != m_stcClkSync.u16RxLostCount) ||
+        (0 != memcmp(m_au8TxData, m_au8RxData, sizeof(m_au8RxData))))
+    {
+        enRet = Error;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Configure RGB LED.
+ * @param  None
+ * @retval None
+ */
+static void LedConfig(void)
+{
+    stc_gpio_init_t stcGpioInit = {0u};
+
+    stcGpioInit.u16PinMode = PIN_MODE_OUT;
+    stcGpioInit.u16PinState = PIN_STATE_SET;
+    GPIO_Init(LED_G_PORT, LED_G_PIN, &stcGpioInit);
+    GPIO_Init(LED_R_PORT, LED_R_PIN, &stcGpioInit);
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/